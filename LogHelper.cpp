@@ -20,13 +20,10 @@ public:
 //			}
 //		}
 	static const uint32_t GetNodeId() {
+		// NodeList indices are node IDs, so the context is the ID of the node
 		uint32_t contextId = ns3::Simulator::GetContext();
-		uint32_t nNodes = ns3::NodeList::GetNNodes();
-		if(contextId < nNodes){
-			ns3::Ptr<ns3::Node> node = ns3::NodeList::GetNode(contextId);
-			const uint32_t nodeId = node->GetId();
-			return nodeId;
-		}
+		if(contextId < ns3::NodeList::GetNNodes())
+			return contextId;
 		else
 			return 10000;
 	}
@@ -4,163 +4,221 @@
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <vector>
+#include <chrono>
+#include <cstring>
 #include "LogHelper.cpp"
 
 using namespace std;
 
+/*
+ * All AddLog* calls append to a single in-memory buffer, which is written to the log file
+ * (opened once) when it exceeds the flush threshold, when the flush interval (wall clock)
+ * has passed since the last write, at Simulator::Destroy and at program exit.
+ *
+ * In the default text format every record is one line of ./CppLogs.txt, as before.  With
+ * SetBinaryFormat(true) records are written to ./CppLogs.bin without formatting, each as
+ *   uint8 type, uint32 nodeId (0xFFFFFFFF if none), uint32 size, message,
+ *   value: 8 bytes for INT and UINT, 1 byte for BOOL, uint32 size + bytes for STRING
+ * in host byte order.
+ */
 class LogManager {
 public:
+	enum ValueType : uint8_t {
+		VALUE_NONE = 0,
+		VALUE_INT = 1,
+		VALUE_UINT = 2,
+		VALUE_BOOL = 3,
+		VALUE_STRING = 4
+	};
+
+	static const uint32_t NO_NODE_ID = 0xFFFFFFFF;
+
 	//Logging without NodeID
-	static void AddLog(std::string message) {
-		std::string fileName = "./CppLogs.txt";
-		fstream myfile;
-		myfile.open(fileName, fstream::app);
-		if (myfile.is_open()) {
-			myfile << message << endl;
-			myfile.close();
-		}
+	static void AddLog(const std::string& message) {
+		append(NO_NODE_ID, message, VALUE_NONE, 0, nullptr, 0);
 	}
-	static void AddLog(std::string message, int number) {
-		std::string fileName = "./CppLogs.txt";
-		fstream myfile;
-		myfile.open(fileName, fstream::app);
-		if (myfile.is_open()) {
-			myfile << message << ":" << number << endl;
-			myfile.close();
-		}
+	static void AddLog(const std::string& message, int number) {
+		append(NO_NODE_ID, message, VALUE_INT, static_cast<uint64_t>(static_cast<int64_t>(number)), nullptr, 0);
 	}
-	static void AddLog(std::string message, uint32_t number) {
-		std::string fileName = "./CppLogs.txt";
-		fstream myfile;
-		myfile.open(fileName, fstream::app);
-		if (myfile.is_open()) {
-			myfile << message << ":" << number << endl;
-			myfile.close();
-		}
+	static void AddLog(const std::string& message, uint32_t number) {
+		append(NO_NODE_ID, message, VALUE_UINT, number, nullptr, 0);
 	}
-	static void AddLog(std::string message, bool number) {
-		std::string fileName = "./CppLogs.txt";
-		fstream myfile;
-		myfile.open(fileName, fstream::app);
-		if (myfile.is_open()) {
-			myfile << message << ":" << number << endl;
-			myfile.close();
-		}
+	static void AddLog(const std::string& message, bool number) {
+		append(NO_NODE_ID, message, VALUE_BOOL, number, nullptr, 0);
 	}
-	static void AddLog(std::string message, std::string value) {
-		std::string fileName = "./CppLogs.txt";
-		fstream myfile;
-		myfile.open(fileName, fstream::app);
-		if (myfile.is_open()) {
-			myfile << message << ":" << value << endl;
-			myfile.close();
-		}
+	static void AddLog(const std::string& message, const std::string& value) {
+		append(NO_NODE_ID, message, VALUE_STRING, 0, value.data(), value.size());
 	}
-	static void AddLog(std::string message, std::vector<std::string> value) {
-		std::string fileName = "./CppLogs.txt";
-		fstream myfile;
-		myfile.open(fileName, fstream::app);
-		if (myfile.is_open()) {
-			std::string temp = "";
-			for(unsigned int i = 0; i < (unsigned)value.size(); i++)
-				temp += value[i];
-
-			myfile << message << ":" << temp << endl;
-			myfile.close();
-		}
+	static void AddLog(const std::string& message, const std::vector<std::string>& value) {
+		std::string temp = join(value);
+		append(NO_NODE_ID, message, VALUE_STRING, 0, temp.data(), temp.size());
 	}
 
 	//Logging with NodeID
-	static void AddLogWithNodeId(std::string message) {
-		std::string fileName = "./CppLogs.txt";
-		fstream myfile;
-		myfile.open(fileName, fstream::app);
-		if (myfile.is_open()) {
-			myfile << "NodeId=" << LogHelper::GetNodeId() << ": " << message<< endl;
-			myfile.close();
-		}
+	static void AddLogWithNodeId(const std::string& message) {
+		append(LogHelper::GetNodeId(), message, VALUE_NONE, 0, nullptr, 0);
 	}
-	static void AddLogWithNodeId(std::string message, int number) {
-		std::string fileName = "./CppLogs.txt";
-		fstream myfile;
-		myfile.open(fileName, fstream::app);
-		if (myfile.is_open()) {
-			myfile << "NodeId=" << LogHelper::GetNodeId() << ": " << message << ":" << number << endl;
-			myfile.close();
-		}
+	static void AddLogWithNodeId(const std::string& message, int number) {
+		append(LogHelper::GetNodeId(), message, VALUE_INT, static_cast<uint64_t>(static_cast<int64_t>(number)), nullptr, 0);
 	}
-	static void AddLogWithNodeId(std::string message, uint32_t number) {
-		std::string fileName = "./CppLogs.txt";
-		fstream myfile;
-		myfile.open(fileName, fstream::app);
-		if (myfile.is_open()) {
-			myfile << "NodeId=" << LogHelper::GetNodeId() << ": " << message << ":" << number << endl;
-			myfile.close();
-		}
+	static void AddLogWithNodeId(const std::string& message, uint32_t number) {
+		append(LogHelper::GetNodeId(), message, VALUE_UINT, number, nullptr, 0);
 	}
-	static void AddLogWithNodeId(std::string message, uint64_t number) {
-		std::string fileName = "./CppLogs.txt";
-		fstream myfile;
-		myfile.open(fileName, fstream::app);
-		if (myfile.is_open()) {
-			myfile << "NodeId=" << LogHelper::GetNodeId() << ": " << message << ":" << number << endl;
-			myfile.close();
-		}
+	static void AddLogWithNodeId(const std::string& message, uint64_t number) {
+		append(LogHelper::GetNodeId(), message, VALUE_UINT, number, nullptr, 0);
 	}
-	static void AddLogWithNodeId(std::string message, uint8_t* number) {
-		std::string fileName = "./CppLogs.txt";
-		fstream myfile;
-		myfile.open(fileName, fstream::app);
-		if (myfile.is_open()) {
-			myfile << "NodeId=" << LogHelper::GetNodeId() << ": " << message << ":" << number << endl;
-			myfile.close();
-		}
+	static void AddLogWithNodeId(const std::string& message, uint8_t* number) {
+		// streamed as a C string, like the original implementation did
+		const char* value = reinterpret_cast<const char*>(number);
+		append(LogHelper::GetNodeId(), message, VALUE_STRING, 0, value, std::strlen(value));
 	}
-	static void AddLogWithNodeId(std::string message, bool number) {
-		std::string fileName = "./CppLogs.txt";
-		fstream myfile;
-		myfile.open(fileName, fstream::app);
-		if (myfile.is_open()) {
-			myfile << "NodeId=" << LogHelper::GetNodeId() << ": " << message << ":" << number << endl;
-			myfile.close();
-		}
+	static void AddLogWithNodeId(const std::string& message, bool number) {
+		append(LogHelper::GetNodeId(), message, VALUE_BOOL, number, nullptr, 0);
 	}
-	static void AddLogWithNodeId(std::string message, std::string value) {
-		std::string fileName = "./CppLogs.txt";
-		fstream myfile;
-		myfile.open(fileName, fstream::app);
-		if (myfile.is_open()) {
-			myfile << "NodeId=" << LogHelper::GetNodeId() << ": " << message << ":" << value << endl;
-			myfile.close();
+	static void AddLogWithNodeId(const std::string& message, const std::string& value) {
+		append(LogHelper::GetNodeId(), message, VALUE_STRING, 0, value.data(), value.size());
+	}
+	static void AddLogWithNodeId(const std::string& message, const std::vector<std::string>& value) {
+		std::string temp = join(value);
+		append(LogHelper::GetNodeId(), message, VALUE_STRING, 0, temp.data(), temp.size());
+	}
+
+	//Configuration
+	static void SetBinaryFormat(bool isBinary) {
+		Sink& sink = getSink();
+		if (sink.isBinary != isBinary) {
+			sink.flush();
+			sink.file.close();
+			sink.isBinary = isBinary;
 		}
 	}
-	static void AddLogWithNodeId(std::string message, std::vector<std::string> value) {
-		std::string fileName = "./CppLogs.txt";
-		fstream myfile;
-		myfile.open(fileName, fstream::app);
-		if (myfile.is_open()) {
-			std::string temp = "";
-			for(unsigned int i = 0; i < (unsigned)value.size(); i++)
-				temp += value[i];
-
-			myfile << "NodeId=" << LogHelper::GetNodeId() << ": " << message << ":" << temp << endl;
-			myfile.close();
+	static void SetFlushThreshold(size_t nBytes) {
+		getSink().flushThreshold = nBytes;
+	}
+	static void SetFlushInterval(double seconds) {
+		getSink().flushInterval = std::chrono::duration<double>(seconds);
+	}
+	static void Flush() {
+		getSink().flush();
+	}
+
+private:
+	struct Sink {
+		std::ofstream file;
+		std::vector<char> buffer;
+		size_t flushThreshold = 1 << 20;
+		std::chrono::duration<double> flushInterval = std::chrono::seconds(1);
+		std::chrono::steady_clock::time_point lastFlush = std::chrono::steady_clock::now();
+		bool isBinary = false;
+		bool isDestroyScheduled = false;
+
+		~Sink() {
+			flush();
 		}
+
+		void flush() {
+			lastFlush = std::chrono::steady_clock::now();
+			if (buffer.empty())
+				return;
+
+			if (!file.is_open()) {
+				std::string fileName = isBinary ? "./CppLogs.bin" : "./CppLogs.txt";
+				file.open(fileName, isBinary ? (fstream::app | fstream::binary) : fstream::app);
+			}
+			if (file.is_open()) {
+				file.write(buffer.data(), buffer.size());
+				file.flush();
+			}
+			buffer.clear();
+		}
+	};
+
+	static Sink& getSink() {
+		static Sink sink;
+		return sink;
+	}
+
+	static void onDestroy() {
+		Sink& sink = getSink();
+		sink.isDestroyScheduled = false;
+		sink.flush();
+	}
+
+	static std::string join(const std::vector<std::string>& value) {
+		std::string temp = "";
+		for(unsigned int i = 0; i < (unsigned)value.size(); i++)
+			temp += value[i];
+		return temp;
+	}
+
+	template<typename T>
+	static void appendRaw(std::vector<char>& buffer, const T& value) {
+		const char* bytes = reinterpret_cast<const char*>(&value);
+		buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
 	}
-	/*Sample code to log with current time
-	#include <time.h>
-	#include <chrono>
-	static void AddLog(std::string message) {
-			std::string fileName = "./CppLogs.txt";
-			fstream myfile;
-			myfile.open(fileName, fstream::app);
-			if (myfile.is_open()) {
-				auto time = std::chrono::system_clock::now();
-				std::time_t currentTime = std::chrono::system_clock::to_time_t(time);
-				myfile << message << " | " << std::ctime(&currentTime);
-				myfile<<"NodeId="<<LogHelper::GetNodeId()<<": "<<message<<endl;
-				myfile.close();
+
+	static void append(uint32_t nodeId, const std::string& message, ValueType type,
+	                   uint64_t number, const char* value, size_t valueSize) {
+		Sink& sink = getSink();
+		if (!sink.isDestroyScheduled) {
+			ns3::Simulator::ScheduleDestroy(&LogManager::onDestroy);
+			sink.isDestroyScheduled = true;
+		}
+
+		std::vector<char>& buffer = sink.buffer;
+		if (sink.isBinary) {
+			appendRaw(buffer, static_cast<uint8_t>(type));
+			appendRaw(buffer, nodeId);
+			appendRaw(buffer, static_cast<uint32_t>(message.size()));
+			buffer.insert(buffer.end(), message.begin(), message.end());
+			switch (type) {
+			case VALUE_INT:
+			case VALUE_UINT:
+				appendRaw(buffer, number);
+				break;
+			case VALUE_BOOL:
+				appendRaw(buffer, static_cast<uint8_t>(number));
+				break;
+			case VALUE_STRING:
+				appendRaw(buffer, static_cast<uint32_t>(valueSize));
+				buffer.insert(buffer.end(), value, value + valueSize);
+				break;
+			default:
+				break;
+			}
+		}
+		else {
+			std::string line;
+			if (nodeId != NO_NODE_ID) {
+				line += "NodeId=";
+				line += std::to_string(nodeId);
+				line += ": ";
 			}
-		} */
+			line += message;
+			switch (type) {
+			case VALUE_INT:
+				line += ":" + std::to_string(static_cast<int64_t>(number));
+				break;
+			case VALUE_UINT:
+			case VALUE_BOOL:
+				line += ":" + std::to_string(number);
+				break;
+			case VALUE_STRING:
+				line += ":";
+				line.append(value, valueSize);
+				break;
+			default:
+				break;
+			}
+			line += '\n';
+			buffer.insert(buffer.end(), line.begin(), line.end());
+		}
+
+		if (buffer.size() >= sink.flushThreshold ||
+		    std::chrono::steady_clock::now() - sink.lastFlush >= sink.flushInterval) {
+			sink.flush();
+		}
+	}
 };
 #endif
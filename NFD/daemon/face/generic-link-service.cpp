@@ -98,6 +98,7 @@ GenericLinkService::doSendInterest(const Interest& interest, const EndpointId& e
   lp::Packet lpPacket(interest.wireEncode());
 
   encodeLpFields(interest, lpPacket);
+  compressNamePrefix(interest.wireEncode(), interest.getName(), lpPacket);
 
   this->sendNetPacket(std::move(lpPacket), endpointId, true);
 }
@@ -108,6 +109,7 @@ GenericLinkService::doSendData(const Data& data, const EndpointId& endpointId)
   lp::Packet lpPacket(data.wireEncode());
 
   encodeLpFields(data, lpPacket);
+  compressNamePrefix(data.wireEncode(), data.getName(), lpPacket);
 
   this->sendNetPacket(std::move(lpPacket), endpointId, false);
 }
@@ -119,6 +121,7 @@ GenericLinkService::doSendNack(const lp::Nack& nack, const EndpointId& endpointI
   lpPacket.add<lp::NackField>(nack.getHeader());
 
   encodeLpFields(nack, lpPacket);
+  compressNamePrefix(nack.getInterest().wireEncode(), nack.getInterest().getName(), lpPacket);
 
   this->sendNetPacket(std::move(lpPacket), endpointId, false);
 }
@@ -157,9 +160,11 @@ GenericLinkService::encodeLpFields(const ndn::PacketBase& netPkt, lp::Packet& lp
 
   shared_ptr<lp::HopCountTag> hopCountTag = netPkt.getTag<lp::HopCountTag>();
   if (hopCountTag != nullptr) {
-    lpPacket.add<lp::HopCountTagField>(*hopCountTag);
+    if (!m_options.allowCompactHeaders || hopCountTag->get() != 0) {
+      lpPacket.add<lp::HopCountTagField>(*hopCountTag);
+    }
   }
-  else {
+  else if (!m_options.allowCompactHeaders) {
     lpPacket.add<lp::HopCountTagField>(0);
   }
 
@@ -173,9 +178,11 @@ GenericLinkService::encodeLpFields(const ndn::PacketBase& netPkt, lp::Packet& lp
 //Atif-Code: Geo Tag Field 
   shared_ptr<lp::GeoTag> geoTag= netPkt.getTag<lp::GeoTag>();
   if (geoTag != nullptr) {
-    lpPacket.add<lp::GeoTagField>(*geoTag);
+    if (!m_options.allowCompactHeaders || geoTag->getPos() != lp::GeoTag().getPos()) {
+      lpPacket.add<lp::GeoTagField>(*geoTag);
+    }
   }
-  else {
+  else if (!m_options.allowCompactHeaders) {
     std::tuple<uint32_t,uint32_t,uint32_t> pos={0,0,0};
     lp::GeoTag geoTag(pos);
     lpPacket.add<lp::GeoTagField>(geoTag);
@@ -184,6 +191,57 @@ GenericLinkService::encodeLpFields(const ndn::PacketBase& netPkt, lp::Packet& lp
 
 }
 
+/** \brief copy of network-layer packet \p netPkt, with its Name replaced by \p name
+ */
+static Block
+replaceName(const Block& netPkt, Block name)
+{
+  name.encode();
+  Block result(netPkt.type());
+  result.push_back(name);
+  std::for_each(std::next(netPkt.elements_begin()), netPkt.elements_end(),
+                [&result] (const Block& element) { result.push_back(element); });
+  result.encode();
+  return result;
+}
+
+void
+GenericLinkService::compressNamePrefix(const Block& netPkt, const Name& name,
+                                       lp::Packet& lpPacket) const
+{
+  size_t context = 0;
+  size_t prefixLength = 0;
+  for (size_t i = 0; i < m_options.nameContexts.size(); ++i) {
+    const Name& prefix = m_options.nameContexts[i];
+    if (prefix.size() > prefixLength && prefix.isPrefixOf(name)) {
+      context = i;
+      prefixLength = prefix.size();
+    }
+  }
+  if (prefixLength == 0) {
+    return;
+  }
+
+  // Name is the first element of both Interest and Data
+  netPkt.parse();
+  const Block& nameBlock = netPkt.elements().front();
+  BOOST_ASSERT(nameBlock.type() == tlv::Name);
+  nameBlock.parse();
+
+  Block suffix(tlv::Name);
+  std::for_each(nameBlock.elements_begin() + prefixLength, nameBlock.elements_end(),
+                [&suffix] (const Block& component) { suffix.push_back(component); });
+  Block compressedPkt = replaceName(netPkt, std::move(suffix));
+
+  // a short prefix may not pay for the field, and for the LpPacket header of a bare packet
+  lp::Packet compressed(lpPacket);
+  compressed.set<lp::FragmentField>({compressedPkt.begin(), compressedPkt.end()});
+  compressed.add<lp::NamePrefixContextField>(context);
+  if (compressed.wireEncode().size() < lpPacket.wireEncode().size()) {
+    lpPacket = std::move(compressed);
+  }
+}
+
 void
 GenericLinkService::sendNetPacket(lp::Packet&& pkt, const EndpointId& endpointId, bool isInterest)
 {
@@ -203,7 +261,7 @@ GenericLinkService::sendNetPacket(lp::Packet&& pkt, const EndpointId& endpointId
 
   if (m_options.allowFragmentation && mtu != MTU_UNLIMITED) {
     bool isOk = false;
-    std::tie(isOk, frags) = m_fragmenter.fragmentPacket(pkt, mtu);
+    std::tie(isOk, frags) = m_fragmenter.fragmentPacket(pkt, mtu, m_lastSeqNo + 1);
     if (!isOk) {
       // fragmentation failed (warning is logged by LpFragmenter)
       ++this->nFragmentationErrors;
@@ -226,10 +284,10 @@ GenericLinkService::sendNetPacket(lp::Packet&& pkt, const EndpointId& endpointId
     BOOST_ASSERT(!frags.front().has<lp::FragCountField>());
   }
 
-  // Only assign sequences to fragments if packet contains more than 1 fragment
+  // Only fragments of a packet split in more than 1 fragment have sequences,
+  // which the fragmenter assigned from m_lastSeqNo + 1
   if (frags.size() > 1) {
-    // Assign sequences to all fragments
-    this->assignSequences(frags);
+    m_lastSeqNo += frags.size();
   }
 
   if (m_options.reliabilityOptions.isEnabled && frags.front().has<lp::FragmentField>()) {
@@ -241,18 +299,6 @@ GenericLinkService::sendNetPacket(lp::Packet&& pkt, const EndpointId& endpointId
   }
 }
 
-void
-GenericLinkService::assignSequence(lp::Packet& pkt)
-{
-  pkt.set<lp::SequenceField>(++m_lastSeqNo);
-}
-
-void
-GenericLinkService::assignSequences(std::vector<lp::Packet>& pkts)
-{
-  std::for_each(pkts.begin(), pkts.end(), [this] (auto& pkt) { this->assignSequence(pkt); });
-}
-
 void
 GenericLinkService::checkCongestionLevel(lp::Packet& pkt)
 {
@@ -338,21 +384,26 @@ GenericLinkService::decodeNetPacket(const Block& netPkt, const lp::Packet& first
                                     const EndpointId& endpointId)
 {
   try {
-    switch (netPkt.type()) {
+    Block wire = netPkt;
+    if (firstPkt.has<lp::NamePrefixContextField>()) {
+      wire = this->restoreNamePrefix(netPkt, firstPkt.get<lp::NamePrefixContextField>());
+    }
+
+    switch (wire.type()) {
       case tlv::Interest:
         if (firstPkt.has<lp::NackField>()) {
-          this->decodeNack(netPkt, firstPkt, endpointId);
+          this->decodeNack(wire, firstPkt, endpointId);
         }
         else {
-          this->decodeInterest(netPkt, firstPkt, endpointId);
+          this->decodeInterest(wire, firstPkt, endpointId);
         }
         break;
       case tlv::Data:
-        this->decodeData(netPkt, firstPkt, endpointId);
+        this->decodeData(wire, firstPkt, endpointId);
         break;
       default:
         ++this->nInNetInvalid;
-        NFD_LOG_FACE_WARN("unrecognized network-layer packet TLV-TYPE " << netPkt.type() << ": DROP");
+        NFD_LOG_FACE_WARN("unrecognized network-layer packet TLV-TYPE " << wire.type() << ": DROP");
         return;
     }
   }
@@ -362,6 +413,27 @@ GenericLinkService::decodeNetPacket(const Block& netPkt, const lp::Packet& first
   }
 }
 
+Block
+GenericLinkService::restoreNamePrefix(const Block& netPkt, uint64_t context) const
+{
+  if (context >= m_options.nameContexts.size()) {
+    NDN_THROW(tlv::Error("unknown NamePrefixContext " + to_string(context)));
+  }
+
+  netPkt.parse();
+  if (netPkt.elements().empty() || netPkt.elements().front().type() != tlv::Name) {
+    NDN_THROW(tlv::Error("expecting Name in packet with NamePrefixContext"));
+  }
+  const Block& suffix = netPkt.elements().front();
+  suffix.parse();
+
+  Block name = m_options.nameContexts[context].wireEncode();
+  name.parse();
+  std::for_each(suffix.elements_begin(), suffix.elements_end(),
+                [&name] (const Block& component) { name.push_back(component); });
+  return replaceName(netPkt, std::move(name));
+}
+
 void
 GenericLinkService::decodeInterest(const Block& netPkt, const lp::Packet& firstPkt,
                                    const EndpointId& endpointId)
@@ -376,6 +448,9 @@ GenericLinkService::decodeInterest(const Block& netPkt, const lp::Packet& firstP
   if (firstPkt.has<lp::HopCountTagField>()) {
     interest->setTag(make_shared<lp::HopCountTag>(firstPkt.get<lp::HopCountTagField>() + 1));
   }
+  else if (m_options.allowCompactHeaders) {
+    interest->setTag(make_shared<lp::HopCountTag>(1));
+  }
 
  // if (m_options.enableGeoTags && firstPkt.has<lp::GeoTagField>()) {
  //   interest->setTag(make_shared<lp::GeoTag>(firstPkt.get<lp::GeoTagField>()));
@@ -385,6 +460,9 @@ GenericLinkService::decodeInterest(const Block& netPkt, const lp::Packet& firstP
   if (firstPkt.has<lp::GeoTagField>()) {
     interest->setTag(make_shared<lp::GeoTag>(firstPkt.get<lp::GeoTagField>()));
   }
+  else if (m_options.allowCompactHeaders) {
+    interest->setTag(make_shared<lp::GeoTag>());
+  }
   // Atif-Code:
   
 
@@ -447,6 +525,9 @@ GenericLinkService::decodeData(const Block& netPkt, const lp::Packet& firstPkt,
   if (firstPkt.has<lp::HopCountTagField>()) {
     data->setTag(make_shared<lp::HopCountTag>(firstPkt.get<lp::HopCountTagField>() + 1));
   }
+  else if (m_options.allowCompactHeaders) {
+    data->setTag(make_shared<lp::HopCountTag>(1));
+  }
 
  // if (m_options.enableGeoTags && firstPkt.has<lp::GeoTagField>()) {
  //   data->setTag(make_shared<lp::GeoTag>(firstPkt.get<lp::GeoTagField>()));
@@ -456,6 +537,9 @@ GenericLinkService::decodeData(const Block& netPkt, const lp::Packet& firstPkt,
   if (firstPkt.has<lp::GeoTagField>()) {
     data->setTag(make_shared<lp::GeoTag>(firstPkt.get<lp::GeoTagField>()));
   }
+  else if (m_options.allowCompactHeaders) {
+    data->setTag(make_shared<lp::GeoTag>());
+  }
   // Atif-Code:  End
   
 
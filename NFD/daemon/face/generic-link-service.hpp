@@ -158,6 +158,22 @@ public:
      *  To enable, set value of enableGeoTags option to a function that generates `shared_ptr<GeoTag>`
      */
     std::function<std::shared_ptr<ndn::lp::GeoTag>()> enableGeoTags;
+
+    /** \brief omits HopCount and GeoTag fields that carry their default value (zero)
+     *
+     *  A received packet without these fields gets the default HopCount and GeoTag, so both
+     *  ends of the link must enable this option.
+     */
+    bool allowCompactHeaders = false;
+
+    /** \brief Name prefixes known to all nodes of the link
+     *
+     *  When the Name of an outgoing packet starts with one of these prefixes, the longest one
+     *  is removed from the packet and its index is sent in a NamePrefixContext field, as
+     *  6LoWPAN header compression does with address contexts.  Both ends of the link must use
+     *  the same list.
+     */
+    std::vector<Name> nameContexts;
   };
 
   /** \brief counters provided by GenericLinkService
@@ -214,6 +230,15 @@ private: // send path
   void
   encodeLpFields(const ndn::PacketBase& netPkt, lp::Packet& lpPacket);
 
+  /** \brief remove from an outgoing LpPacket the longest Name prefix found in
+   *         Options::nameContexts, if that makes the LpPacket smaller
+   *  \param netPkt network-layer packet carried in \p lpPacket
+   *  \param name Name of \p netPkt
+   *  \param lpPacket LpPacket with all other link protocol fields
+   */
+  void
+  compressNamePrefix(const Block& netPkt, const Name& name, lp::Packet& lpPacket) const;
+
   /** \brief send a complete network layer packet
    *  \param pkt LpPacket containing a complete network layer packet
    *  \param endpointId destination endpoint to which LpPacket will be sent
@@ -222,16 +247,6 @@ private: // send path
   void
   sendNetPacket(lp::Packet&& pkt, const EndpointId& endpointId, bool isInterest);
 
-  /** \brief assign a sequence number to an LpPacket
-   */
-  void
-  assignSequence(lp::Packet& pkt);
-
-  /** \brief assign consecutive sequence numbers to LpPackets
-   */
-  void
-  assignSequences(std::vector<lp::Packet>& pkts);
-
   /** \brief if the send queue is found to be congested, add a congestion mark to the packet
    *         according to CoDel
    *  \sa https://tools.ietf.org/html/rfc8289
@@ -256,6 +271,12 @@ private: // receive path
   void
   decodeNetPacket(const Block& netPkt, const lp::Packet& firstPkt, const EndpointId& endpointId);
 
+  /** \brief put back the Name prefix of a packet received with a NamePrefixContext field
+   *  \throw tlv::Error the context is unknown, or the packet has no Name
+   */
+  Block
+  restoreNamePrefix(const Block& netPkt, uint64_t context) const;
+
   /** \brief decode incoming Interest
    *  \param netPkt reassembled network-layer packet; TLV-TYPE must be Interest
    *  \param firstPkt LpPacket of first fragment; must not have Nack field
@@ -26,6 +26,7 @@
 #include "lp-fragmenter.hpp"
 #include "link-service.hpp"
 
+#include <ndn-cxx/encoding/encoding-buffer.hpp>
 #include <ndn-cxx/encoding/tlv.hpp>
 
 namespace nfd {
@@ -57,6 +58,22 @@ static const size_t MAX_FRAG_OVERHEAD =
   1 + 1 + 8 + // FragCount TLV
   1 + 9; // Fragment TLV-TYPE and TLV-LENGTH
 
+/** \brief overhead of a single fragment and of adding fragmentation to payload, when
+ *         TLV-LENGTH cannot exceed \p mtu and FragCount cannot exceed \p nMaxFragments
+ */
+static std::tuple<size_t, size_t>
+getMtuBoundOverhead(size_t mtu, size_t nMaxFragments)
+{
+  size_t lengthSize = ndn::tlv::sizeOfVarNumber(mtu);
+  size_t singleFragOverhead =
+    1 + lengthSize + // LpPacket TLV-TYPE and TLV-LENGTH
+    1 + 1 + 8 + // Sequence TLV
+    1 + lengthSize; // Fragment TLV-TYPE and TLV-LENGTH
+  size_t fragOverhead = singleFragOverhead +
+    2 * (1 + 1 + ndn::tlv::sizeOfNonNegativeInteger(nMaxFragments)); // FragIndex and FragCount TLVs
+  return std::make_tuple(singleFragOverhead, fragOverhead);
+}
+
 LpFragmenter::LpFragmenter(const LpFragmenter::Options& options, const LinkService* linkService)
   : m_options(options)
   , m_linkService(linkService)
@@ -76,13 +93,21 @@ LpFragmenter::getLinkService() const
 }
 
 std::tuple<bool, std::vector<lp::Packet>>
-LpFragmenter::fragmentPacket(const lp::Packet& packet, size_t mtu)
+LpFragmenter::fragmentPacket(const lp::Packet& packet, size_t mtu,
+                             optional<lp::Sequence> firstSequence)
 {
   BOOST_ASSERT(packet.has<lp::FragmentField>());
   BOOST_ASSERT(!packet.has<lp::FragIndexField>());
   BOOST_ASSERT(!packet.has<lp::FragCountField>());
 
-  if (MAX_SINGLE_FRAG_OVERHEAD + packet.wireEncode().size() <= mtu) {
+  size_t maxSingleFragOverhead = MAX_SINGLE_FRAG_OVERHEAD;
+  size_t maxFragOverhead = MAX_FRAG_OVERHEAD;
+  if (m_options.isOverheadBoundByMtu) {
+    std::tie(maxSingleFragOverhead, maxFragOverhead) =
+      getMtuBoundOverhead(mtu, m_options.nMaxFragments);
+  }
+
+  if (maxSingleFragOverhead + packet.wireEncode().size() <= mtu) {
     // fast path: fragmentation not needed
     // To qualify for fast path, the packet must have space for adding a sequence number,
     // because another NDNLPv2 feature may require the sequence number.
@@ -105,12 +130,12 @@ LpFragmenter::fragmentPacket(const lp::Packet& packet, size_t mtu)
   }
 
   // compute payload size
-  if (MAX_FRAG_OVERHEAD + firstHeaderSize + 1 > mtu) { // 1-octet fragment
+  if (maxFragOverhead + firstHeaderSize + 1 > mtu) { // 1-octet fragment
     NFD_LOG_FACE_WARN("fragmentation error, MTU too small for first fragment: DROP");
     return std::make_tuple(false, std::vector<lp::Packet>{});
   }
-  size_t firstPayloadSize = std::min(netPktSize, mtu - firstHeaderSize - MAX_FRAG_OVERHEAD);
-  size_t payloadSize = mtu - MAX_FRAG_OVERHEAD;
+  size_t firstPayloadSize = std::min(netPktSize, mtu - firstHeaderSize - maxFragOverhead);
+  size_t payloadSize = mtu - maxFragOverhead;
   size_t fragCount = 1 + ((netPktSize - firstPayloadSize) / payloadSize) +
                      ((netPktSize - firstPayloadSize) % payloadSize != 0);
 
@@ -120,26 +145,42 @@ LpFragmenter::fragmentPacket(const lp::Packet& packet, size_t mtu)
     return std::make_tuple(false, std::vector<lp::Packet>{});
   }
 
-  // populate fragments
-  std::vector<lp::Packet> frags(fragCount);
-  frags.front() = packet; // copy input packet to preserve other NDNLPv2 fields
-  size_t fragIndex = 0;
+  // populate fragments, encoding each one back to front into a buffer of the MTU
+  std::vector<lp::Packet> frags;
+  frags.reserve(fragCount);
   auto fragBegin = netPktBegin,
        fragEnd = fragBegin + firstPayloadSize;
-  while (fragBegin < netPktEnd) {
-    lp::Packet& frag = frags[fragIndex];
-    frag.add<lp::FragIndexField>(fragIndex);
-    frag.add<lp::FragCountField>(fragCount);
-    frag.set<lp::FragmentField>({fragBegin, fragEnd});
-    BOOST_ASSERT(frag.wireEncode().size() <= mtu);
-
-    ++fragIndex;
+  for (size_t fragIndex = 0; fragIndex < fragCount; ++fragIndex) {
+    ndn::EncodingBuffer encoder(mtu, 0);
+    size_t length = lp::FragmentField::encode(encoder, {fragBegin, fragEnd});
+
+    if (fragIndex == 0 && packetWire.type() == lp::tlv::LpPacket) {
+      // other NDNLPv2 headers of the input packet, which all sort after FragCount
+      for (auto it = packetWire.elements().rbegin(); it != packetWire.elements().rend(); ++it) {
+        if (it->type() != lp::tlv::Fragment) {
+          BOOST_ASSERT(it->type() > lp::tlv::FragCount);
+          length += encoder.prependBlock(*it);
+        }
+      }
+    }
+
+    length += lp::FragCountField::encode(encoder, fragCount);
+    length += lp::FragIndexField::encode(encoder, fragIndex);
+    if (firstSequence) {
+      length += lp::SequenceField::encode(encoder, *firstSequence + fragIndex);
+    }
+    length += encoder.prependVarNumber(length);
+    length += encoder.prependVarNumber(lp::tlv::LpPacket);
+    BOOST_ASSERT(length <= mtu);
+
+    frags.emplace_back(encoder.block());
+
     fragBegin = fragEnd;
     fragEnd = std::min(netPktEnd, fragBegin + payloadSize);
   }
-  BOOST_ASSERT(fragIndex == fragCount);
+  BOOST_ASSERT(fragBegin == netPktEnd);
 
-  return std::make_tuple(true, frags);
+  return std::make_tuple(true, std::move(frags));
 }
 
 std::ostream&
@@ -46,6 +46,13 @@ public:
     /** \brief maximum number of fragments in a packet
      */
     size_t nMaxFragments = 400;
+
+    /** \brief reserve on each fragment only the overhead that a fragment fitting in the MTU
+     *         can take, instead of the overhead of the largest TLV-LENGTH
+     *
+     *  This leaves more room for payload when the MTU is small, e.g. on IEEE 802.15.4.
+     */
+    bool isOverheadBoundByMtu = false;
   };
 
   explicit
@@ -67,10 +74,17 @@ public:
    *  \param packet an LpPacket that contains a network-layer packet;
    *                must have Fragment field, must not have FragIndex and FragCount fields
    *  \param mtu maximum allowable LpPacket size after fragmentation and sequence number assignment
-   *  \return whether fragmentation succeeded, fragmented packets without sequence number
+   *  \param firstSequence if set, sequence number of the first fragment, the following
+   *                       fragments being numbered consecutively; a packet that fits in the MTU
+   *                       is returned unchanged, without sequence number
+   *  \return whether fragmentation succeeded, fragmented packets
+   *
+   *  Each fragment is encoded once into its own buffer, with its slice of the network-layer
+   *  packet.
    */
   std::tuple<bool, std::vector<lp::Packet>>
-  fragmentPacket(const lp::Packet& packet, size_t mtu);
+  fragmentPacket(const lp::Packet& packet, size_t mtu,
+                 optional<lp::Sequence> firstSequence = nullopt);
 
 private:
   Options m_options;
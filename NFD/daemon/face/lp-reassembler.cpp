@@ -34,6 +34,8 @@ namespace face {
 
 NFD_LOG_INIT(LpReassembler);
 
+constexpr size_t LpReassembler::NOT_RECEIVED;
+
 LpReassembler::LpReassembler(const LpReassembler::Options& options, const LinkService* linkService)
   : m_options(options)
   , m_linkService(linkService)
@@ -83,32 +85,43 @@ LpReassembler::receiveFragment(EndpointId remoteEndpoint, const lp::Packet& pack
   lp::Sequence messageIdentifier = packet.get<lp::SequenceField>() - fragIndex;
   Key key = std::make_tuple(remoteEndpoint, messageIdentifier);
 
+  ndn::Buffer::const_iterator fragBegin, fragEnd;
+  std::tie(fragBegin, fragEnd) = packet.get<lp::FragmentField>();
+  size_t fragSize = std::distance(fragBegin, fragEnd);
+
   // add to PartialPacket
   PartialPacket& pp = m_partialPackets[key];
-  if (pp.fragCount == 0) { // new PartialPacket
-    pp.fragCount = fragCount;
-    pp.nReceivedFragments = 0;
-    pp.fragments.resize(fragCount);
+  if (pp.fragSizes.empty()) { // new PartialPacket
+    pp.fragSizes.assign(fragCount, NOT_RECEIVED);
+    pp.stride = fragSize;
+    pp.payload = make_shared<ndn::Buffer>(fragCount * fragSize);
   }
   else {
-    if (fragCount != pp.fragCount) {
+    if (fragCount != pp.fragSizes.size()) {
       NFD_LOG_FACE_WARN("reassembly error, FragCount changed: DROP");
       return FALSE_RETURN;
     }
   }
 
-  if (pp.fragments[fragIndex].has<lp::SequenceField>()) {
+  if (pp.fragSizes[fragIndex] != NOT_RECEIVED) {
     NFD_LOG_FACE_TRACE("fragment already received: DROP");
     return FALSE_RETURN;
   }
 
-  pp.fragments[fragIndex] = packet;
+  if (fragSize > pp.stride) {
+    setStride(pp, fragSize);
+  }
+  std::copy(fragBegin, fragEnd, pp.payload->begin() + fragIndex * pp.stride);
+  pp.fragSizes[fragIndex] = fragSize;
+  if (fragIndex == 0) {
+    pp.firstFragment = packet;
+  }
   ++pp.nReceivedFragments;
 
   // check complete condition
-  if (pp.nReceivedFragments == pp.fragCount) {
-    Block reassembled = doReassembly(key);
-    lp::Packet firstFrag(std::move(pp.fragments[0]));
+  if (pp.nReceivedFragments == fragCount) {
+    Block reassembled = doReassembly(pp);
+    lp::Packet firstFrag(std::move(pp.firstFragment));
     m_partialPackets.erase(key);
     return std::make_tuple(true, reassembled, firstFrag);
   }
@@ -119,28 +132,34 @@ LpReassembler::receiveFragment(EndpointId remoteEndpoint, const lp::Packet& pack
   return FALSE_RETURN;
 }
 
-Block
-LpReassembler::doReassembly(const Key& key)
+void
+LpReassembler::setStride(PartialPacket& pp, size_t stride)
 {
-  PartialPacket& pp = m_partialPackets[key];
-
-  size_t payloadSize = std::accumulate(pp.fragments.begin(), pp.fragments.end(), 0U,
-    [&] (size_t sum, const lp::Packet& pkt) -> size_t {
-      ndn::Buffer::const_iterator fragBegin, fragEnd;
-      std::tie(fragBegin, fragEnd) = pkt.get<lp::FragmentField>();
-      return sum + std::distance(fragBegin, fragEnd);
-    });
-
-  ndn::Buffer fragBuffer(payloadSize);
-  auto it = fragBuffer.begin();
+  auto payload = make_shared<ndn::Buffer>(pp.fragSizes.size() * stride);
+  for (size_t i = 0; i < pp.fragSizes.size(); ++i) {
+    if (pp.fragSizes[i] != NOT_RECEIVED) {
+      auto fragBegin = pp.payload->begin() + i * pp.stride;
+      std::copy(fragBegin, fragBegin + pp.fragSizes[i], payload->begin() + i * stride);
+    }
+  }
+  pp.payload = std::move(payload);
+  pp.stride = stride;
+}
 
-  for (const lp::Packet& frag : pp.fragments) {
-    ndn::Buffer::const_iterator fragBegin, fragEnd;
-    std::tie(fragBegin, fragEnd) = frag.get<lp::FragmentField>();
-    it = std::copy(fragBegin, fragEnd, it);
+Block
+LpReassembler::doReassembly(PartialPacket& pp)
+{
+  // fragment i is copied from i * stride into a buffer of the exact size, so that the Block
+  // does not keep the buffer of all strides alive
+  size_t payloadSize = std::accumulate(pp.fragSizes.begin(), pp.fragSizes.end(), size_t(0));
+  auto payload = make_shared<ndn::Buffer>(payloadSize);
+  auto out = payload->begin();
+  for (size_t i = 0; i < pp.fragSizes.size(); ++i) {
+    auto fragBegin = pp.payload->begin() + i * pp.stride;
+    out = std::copy(fragBegin, fragBegin + pp.fragSizes[i], out);
   }
 
-  return Block(&*(fragBuffer.cbegin()), std::distance(fragBuffer.cbegin(), fragBuffer.cend()));
+  return Block(std::move(payload));
 }
 
 void
@@ -30,6 +30,9 @@
 
 #include <ndn-cxx/lp/packet.hpp>
 
+#include <limits>
+#include <unordered_map>
+
 namespace nfd {
 namespace face {
 
@@ -96,16 +99,25 @@ public:
   signal::Signal<LpReassembler, EndpointId, size_t> beforeTimeout;
 
 private:
-  /** \brief holds all fragments of packet until reassembled
+  /** \brief holds the payload of the fragments of a packet until reassembled
+   *
+   *  The payload of fragment i is copied at i * stride in one buffer, and the fragments are
+   *  copied next to each other into a buffer of the exact size once all are received.  The stride starts as the payload size
+   *  of the first fragment received, and grows if a larger payload arrives, which happens at
+   *  most a few times since all fragments but the first and last ones have the same size.
    */
   struct PartialPacket
   {
-    std::vector<lp::Packet> fragments;
-    size_t fragCount; ///< total fragments
-    size_t nReceivedFragments; ///< number of received fragments
+    lp::Packet firstFragment; ///< fragment 0, for inspecting other NDNLPv2 headers
+    shared_ptr<ndn::Buffer> payload;
+    std::vector<size_t> fragSizes; ///< payload size of each fragment, NOT_RECEIVED if missing
+    size_t stride = 0;
+    size_t nReceivedFragments = 0; ///< number of received fragments
     scheduler::ScopedEventId dropTimer;
   };
 
+  static constexpr size_t NOT_RECEIVED = std::numeric_limits<size_t>::max();
+
   /** \brief index key for PartialPackets
    */
   typedef std::tuple<
@@ -113,8 +125,22 @@ private:
     lp::Sequence // message identifier (sequence of the first fragment)
   > Key;
 
-  Block
-  doReassembly(const Key& key);
+  struct KeyHash
+  {
+    size_t
+    operator()(const Key& key) const noexcept
+    {
+      return std::hash<uint64_t>()(std::get<1>(key) ^ (std::get<0>(key) * 0x9e3779b97f4a7c15));
+    }
+  };
+
+  /** \brief change the stride of \p pp, moving the fragments received so far
+   */
+  static void
+  setStride(PartialPacket& pp, size_t stride);
+
+  static Block
+  doReassembly(PartialPacket& pp);
 
   void
   timeoutPartialPacket(const Key& key);
@@ -122,7 +148,7 @@ private:
 private:
   Options m_options;
   const LinkService* m_linkService;
-  std::map<Key, PartialPacket> m_partialPackets;
+  std::unordered_map<Key, PartialPacket, KeyHash> m_partialPackets;
 };
 
 std::ostream&
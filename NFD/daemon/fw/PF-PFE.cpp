@@ -30,6 +30,7 @@
 #include "forwarder.hpp"
 
 #include "algorithm.hpp"
+#include "downstream-collector.hpp"
 
 #include "common/global.hpp"
 #include "common/logger.hpp"
@@ -102,14 +103,17 @@ getDefaultStrategyName()
   return fw::BestRouteStrategy2::getStrategyName();
 }
 
-Forwarder::Forwarder(FaceTable& faceTable)
+Forwarder::Forwarder(FaceTable& faceTable, name_tree::HashtableLayout nameTreeLayout)
   : m_faceTable(faceTable)
   , m_unsolicitedDataPolicy(make_unique<fw::DefaultUnsolicitedDataPolicy>())
+  , m_nameTree(1024, nameTreeLayout)
   , m_fib(m_nameTree)
   , m_pit(m_nameTree)
+  , m_pitExpiry([this] (const shared_ptr<pit::Entry>& pitEntry) { onInterestFinalize(pitEntry); })
   , m_measurements(m_nameTree)
   , m_strategyChoice(*this)
   , m_csFace(face::makeNullFace(FaceUri("contentstore://")))
+  , m_rebroadcastRng(ns3::CreateObject<ns3::UniformRandomVariable>())
 {
   m_faceTable.addReserved(m_csFace, face::FACEID_CONTENT_STORE);
 
@@ -145,6 +149,17 @@ Forwarder::Forwarder(FaceTable& faceTable)
 
 Forwarder::~Forwarder() = default;
 
+int64_t
+Forwarder::assignStreams(int64_t stream)
+{
+  m_rebroadcastRng->SetStream(stream);
+  int64_t nStreams = 1;
+  for (const auto& entry : m_strategyChoice) {
+    nStreams += entry.getStrategy().assignStreams(stream + nStreams);
+  }
+  return nStreams;
+}
+
 
 
 
@@ -171,8 +186,11 @@ Forwarder::onIncomingInterest(const FaceEndpoint& ingress, const Interest& inter
   }
 
    
+  // hash the name once for Dead Nonce List, PIT, and CS
+  name_tree::HashSequence hashes = name_tree::computeHashes(interest.getName());
+
   // detect duplicate Nonce with Dead Nonce List
-  bool hasDuplicateNonceInDnl = m_deadNonceList.has(interest.getName(), interest.getNonce());
+  bool hasDuplicateNonceInDnl = m_deadNonceList.has(hashes.back(), interest.getNonce());
   if (hasDuplicateNonceInDnl) {
     // goto Interest loop pipeline
     this->onInterestLoop(ingress, interest);
@@ -192,7 +210,7 @@ Forwarder::onIncomingInterest(const FaceEndpoint& ingress, const Interest& inter
 
 
   // PIT insert
-  shared_ptr<pit::Entry> pitEntry = m_pit.insert(interest).first;
+  shared_ptr<pit::Entry> pitEntry = m_pit.insert(interest, hashes).first;
 
   // detect duplicate Nonce in PIT entry
   int dnw = fw::findDuplicateNonce(*pitEntry, interest.getNonce(), ingress.face);
@@ -213,7 +231,7 @@ Forwarder::onIncomingInterest(const FaceEndpoint& ingress, const Interest& inter
 
   // is pending?
   if (!pitEntry->hasInRecords()) {
-    m_cs.find(interest,
+    m_cs.find(interest, hashes,
               bind(&Forwarder::onContentStoreHit, this, ingress, pitEntry, _1, _2),
               bind(&Forwarder::onContentStoreMiss, this, ingress, pitEntry, _1));
   }
@@ -323,83 +341,24 @@ Forwarder::onOutgoingInterest(const shared_ptr<pit::Entry>& pitEntry,
 {
   NFD_LOG_DEBUG("onOutgoingInterest out=" << egress << " interest=" << pitEntry->getName());
 
-
-  int y= egress.face.getId();         
-    
-
-  auto name= interest.getName();
-  
-
-  int x = 0;
+  // an Interest received on the broadcast face is re-broadcast on it only with a probability,
+  // unless the strategy has made that decision itself;
+  // Interests coming from any other face (local applications, internal faces) are always sent
   auto incomingFaceIdTag = interest.getTag<lp::IncomingFaceIdTag>();
-  if (incomingFaceIdTag != nullptr) { x = *incomingFaceIdTag;} 
-
- 
- 
- if(y!=257) 
-   {       
-          
-      pitEntry->insertOrUpdateOutRecord(egress.face, interest);
-      egress.face.sendInterest(interest, egress.endpoint);
-      ++m_counters.nOutInterests; 
-      return;
-   } 
-   
+  bool isRebroadcast = egress.face.getId() == m_broadcastFaceId &&
+                       incomingFaceIdTag != nullptr && *incomingFaceIdTag == m_broadcastFaceId;
+  if (isRebroadcast && !m_strategyChoice.findEffectiveStrategy(*pitEntry).decidesRebroadcast() &&
+      m_rebroadcastRng->GetValue() > m_rebroadcastProbability) {
+    NFD_LOG_DEBUG("onOutgoingInterest out=" << egress << " interest=" << pitEntry->getName()
+                  << " rebroadcast-suppressed");
+    return;
+  }
 
-  if(y==257 && x!=257 && x!=258) 
-   {       
-     
-              
-      pitEntry->insertOrUpdateOutRecord(egress.face, interest);
-      egress.face.sendInterest(interest, egress.endpoint);
-      ++m_counters.nOutInterests; 
-     
-      return;
-   } 
-   
-   
- 
-  if(y==257 && x==258) 
-   {       
-   
-              
-      pitEntry->insertOrUpdateOutRecord(egress.face, interest);
-      egress.face.sendInterest(interest, egress.endpoint);
-      ++m_counters.nOutInterests; 
-     
-      return;
-   } 
-   
-   
-     
-         
- if(y==257 && x==257) 
-  {    
-  
-     
-       
-     ns3::Ptr<ns3::UniformRandomVariable> uv = ns3::CreateObject<ns3::UniformRandomVariable> ();
-     double p=uv->GetValue ();
-  
-                      
-                      
-        if(p <=0.85)  
-             {   
-                  pitEntry->insertOrUpdateOutRecord(egress.face, interest);
-                  egress.face.sendInterest(interest, egress.endpoint);                                      
-                  ++m_counters.nOutInterests;                                      
-           
-               }
-               
-                                                                                    
-                                          
- }                           
-                    
+  pitEntry->insertOrUpdateOutRecord(egress.face, interest);
+  egress.face.sendInterest(interest, egress.endpoint);
+  ++m_counters.nOutInterests;
 }
 
-
-
-
 void
 Forwarder::onInterestFinalize(const shared_ptr<pit::Entry>& pitEntry)
 {
@@ -449,8 +408,11 @@ Forwarder::onIncomingData(const FaceEndpoint& ingress, const Data& data)
 
 
 
+  // hash the name once for PIT and CS
+  name_tree::HashSequence hashes = name_tree::computeHashes(data.getName());
+
   // PIT match
-  pit::DataMatchResult pitMatches = m_pit.findAllDataMatches(data);
+  pit::DataMatchResult pitMatches = m_pit.findAllDataMatches(data, hashes);
   if (pitMatches.size() == 0) {
 
     
@@ -462,7 +424,7 @@ Forwarder::onIncomingData(const FaceEndpoint& ingress, const Data& data)
   
   // CS insert
   
-  m_cs.insert(data);
+  m_cs.insert(data, hashes);
 
   // when only one PIT entry is matched, trigger strategy: after receive Data
   if (pitMatches.size() == 1) {
@@ -491,7 +453,7 @@ Forwarder::onIncomingData(const FaceEndpoint& ingress, const Data& data)
   // when more than one PIT entry is matched, trigger strategy: before satisfy Interest,
   // and send Data to all matched out faces
   else {
-    std::set<std::pair<Face*, EndpointId>> pendingDownstreams;
+    fw::DownstreamCollector pendingDownstreams;
     auto now = time::steady_clock::now();
 
     for (const auto& pitEntry : pitMatches) {
@@ -500,7 +462,7 @@ Forwarder::onIncomingData(const FaceEndpoint& ingress, const Data& data)
       // remember pending downstreams
       for (const pit::InRecord& inRecord : pitEntry->getInRecords()) {
         if (inRecord.getExpiry() > now) {
-          pendingDownstreams.emplace(&inRecord.getFace(), 0);
+          pendingDownstreams.add(inRecord.getFace());
         }
       }
 
@@ -524,10 +486,10 @@ Forwarder::onIncomingData(const FaceEndpoint& ingress, const Data& data)
       pitEntry->deleteOutRecord(ingress.face);
     }
 
-    // foreach pending downstream
+    // foreach pending downstream;
+    // in-records do not keep the endpoint, so the ingress face is excluded whatever the endpoint
     for (const auto& pendingDownstream : pendingDownstreams) {
       if (pendingDownstream.first->getId() == ingress.face.getId() &&
-          pendingDownstream.second == ingress.endpoint &&
           pendingDownstream.first->getLinkType() != ndn::nfd::LINK_TYPE_AD_HOC) {
         continue;
       }
@@ -745,8 +707,7 @@ Forwarder::setExpiryTimer(const shared_ptr<pit::Entry>& pitEntry, time::millisec
   BOOST_ASSERT(pitEntry);
   BOOST_ASSERT(duration >= 0_ms);
 
-  pitEntry->expiryTimer.cancel();
-  pitEntry->expiryTimer = getScheduler().schedule(duration, [=] { onInterestFinalize(pitEntry); });
+  m_pitExpiry.schedule(pitEntry->expiryTimer, pitEntry, duration);
 }
 
 void
@@ -764,19 +725,25 @@ Forwarder::insertDeadNonceList(pit::Entry& pitEntry, Face* upstream)
     return;
   }
 
+  // the name tree entry already has the hash of the name, unless the name ends with an
+  // implicit digest or is deeper than the name tree
+  const name_tree::Entry* nte = m_nameTree.getEntry(pitEntry);
+  size_t nameHash = nte != nullptr && nte->getName().size() == pitEntry.getName().size() ?
+                    name_tree::getNode(*nte)->hash : name_tree::computeHash(pitEntry.getName());
+
   // Dead Nonce List insert
   if (upstream == nullptr) {
     // insert all outgoing Nonces
     const auto& outRecords = pitEntry.getOutRecords();
     std::for_each(outRecords.begin(), outRecords.end(), [&] (const auto& outRecord) {
-      m_deadNonceList.add(pitEntry.getName(), outRecord.getLastNonce());
+      m_deadNonceList.add(nameHash, outRecord.getLastNonce());
     });
   }
   else {
     // insert outgoing Nonce of a specific face
     auto outRecord = pitEntry.getOutRecord(*upstream);
     if (outRecord != pitEntry.getOutRecords().end()) {
-      m_deadNonceList.add(pitEntry.getName(), outRecord->getLastNonce());
+      m_deadNonceList.add(nameHash, outRecord->getLastNonce());
     }
   }
 }
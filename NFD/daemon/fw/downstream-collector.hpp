@@ -0,0 +1,110 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_DOWNSTREAM_COLLECTOR_HPP
+#define NFD_DAEMON_FW_DOWNSTREAM_COLLECTOR_HPP
+
+#include "face/face.hpp"
+
+#include <boost/container/small_vector.hpp>
+
+namespace nfd {
+namespace fw {
+
+/** \brief collects the distinct downstreams of Data that satisfies several PIT entries
+ *
+ *  Downstreams are kept in the order they are first added. Up to INLINE_CAPACITY of them are
+ *  stored inside the object, so that the collector does not allocate when it lives on the
+ *  stack. A 64-bit bitmap indexed by FaceId modulo 64 records the faces already added, and
+ *  the stored downstreams are only searched when a bit is already set.
+ */
+class DownstreamCollector : noncopyable
+{
+public:
+  static constexpr size_t INLINE_CAPACITY = 8;
+
+  using Downstream = std::pair<Face*, EndpointId>;
+  using Container = boost::container::small_vector<Downstream, INLINE_CAPACITY>;
+  using const_iterator = Container::const_iterator;
+
+  /** \brief add a downstream, unless it has been added before
+   *  \return whether the downstream was added
+   */
+  bool
+  add(Face& face, EndpointId endpoint = 0)
+  {
+    uint64_t bit = uint64_t(1) << (face.getId() % 64);
+    if ((m_bitmap & bit) != 0) {
+      for (const Downstream& downstream : m_downstreams) {
+        if (downstream.first == &face && downstream.second == endpoint) {
+          return false;
+        }
+      }
+    }
+    m_bitmap |= bit;
+    m_downstreams.emplace_back(&face, endpoint);
+    return true;
+  }
+
+  const_iterator
+  begin() const
+  {
+    return m_downstreams.begin();
+  }
+
+  const_iterator
+  end() const
+  {
+    return m_downstreams.end();
+  }
+
+  size_t
+  size() const
+  {
+    return m_downstreams.size();
+  }
+
+  bool
+  empty() const
+  {
+    return m_downstreams.empty();
+  }
+
+  void
+  clear()
+  {
+    m_downstreams.clear();
+    m_bitmap = 0;
+  }
+
+private:
+  Container m_downstreams;
+  uint64_t m_bitmap = 0;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_DOWNSTREAM_COLLECTOR_HPP
@@ -38,6 +38,8 @@
 #include "table/dead-nonce-list.hpp"
 #include "table/network-region-table.hpp"
 
+#include "ns3/ptr.h"
+#include "ns3/random-variable-stream.h"
 
 namespace nfd {
 
@@ -53,8 +55,12 @@ class Forwarder
 {
 
 public:
+  /** \param faceTable the table of faces
+   *  \param nameTreeLayout memory layout of the NameTree hashtable
+   */
   explicit
-  Forwarder(FaceTable& faceTable);
+  Forwarder(FaceTable& faceTable,
+            name_tree::HashtableLayout nameTreeLayout = name_tree::HashtableLayout::CHAINED);
 
   VIRTUAL_WITH_TESTS
   ~Forwarder();
@@ -167,6 +173,45 @@ public: // forwarding entrypoints and tables
     return m_networkRegionTable;
   }
 
+public: // probabilistic re-broadcast
+  /** \brief get probability of forwarding an Interest received on the broadcast face back
+   *         to the broadcast face
+   */
+  double
+  getRebroadcastProbability() const
+  {
+    return m_rebroadcastProbability;
+  }
+
+  void
+  setRebroadcastProbability(double probability)
+  {
+    BOOST_ASSERT(probability >= 0.0 && probability <= 1.0);
+    m_rebroadcastProbability = probability;
+  }
+
+  /** \brief get ID of the face on which Interests are re-broadcast probabilistically
+   */
+  FaceId
+  getBroadcastFaceId() const
+  {
+    return m_broadcastFaceId;
+  }
+
+  void
+  setBroadcastFaceId(FaceId faceId)
+  {
+    m_broadcastFaceId = faceId;
+  }
+
+  /** \brief assign fixed random variable stream numbers to the re-broadcast decision and
+   *         to the strategy instances
+   *  \return number of streams that have been assigned
+   *  \note Strategies chosen afterwards keep unfixed streams.
+   */
+  int64_t
+  assignStreams(int64_t stream);
+
 public:
   /** \brief trigger before PIT entry is satisfied
    *  \sa Strategy::beforeSatisfyInterest
@@ -254,6 +299,9 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE: // pipelines
 
 PROTECTED_WITH_TESTS_ELSE_PRIVATE:
   /** \brief set a new expiry timer (now + \p duration) on a PIT entry
+   *
+   *  The timer runs on a timing wheel shared by the PIT entries of this forwarder, and fires
+   *  at most one millisecond late.
    */
   void
   setExpiryTimer(const shared_ptr<pit::Entry>& pitEntry, time::milliseconds duration);
@@ -369,6 +417,7 @@ private:
   NameTree           m_nameTree;
   Fib                m_fib;
   Pit                m_pit;
+  pit::ExpiryWheel   m_pitExpiry;
   
   Cs                 m_cs;
   Measurements       m_measurements;
@@ -377,6 +426,10 @@ private:
   NetworkRegionTable m_networkRegionTable;
   shared_ptr<Face>   m_csFace;
 
+  ns3::Ptr<ns3::UniformRandomVariable> m_rebroadcastRng;
+  double m_rebroadcastProbability = 0.85;
+  FaceId m_broadcastFaceId = 257;
+
   
   
   
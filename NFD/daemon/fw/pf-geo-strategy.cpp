@@ -0,0 +1,223 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pf-geo-strategy.hpp"
+#include "algorithm.hpp"
+#include "common/logger.hpp"
+
+#include <ndn-cxx/lp/geo-tag.hpp>
+#include <ndn-cxx/lp/tags.hpp>
+
+#include <boost/lexical_cast.hpp>
+
+namespace nfd {
+namespace fw {
+
+NFD_REGISTER_STRATEGY(PfGeoStrategy);
+
+NFD_LOG_INIT(PfGeoStrategy);
+
+const time::microseconds PfGeoStrategy::RETX_SUPPRESSION_INITIAL(10);
+const time::milliseconds PfGeoStrategy::RETX_SUPPRESSION_MAX(250);
+
+PfGeoStrategy::PfGeoStrategy(Forwarder& forwarder, const Name& name)
+  : Strategy(forwarder)
+  , ProcessNackTraits(this)
+  , m_retxSuppression(RETX_SUPPRESSION_INITIAL,
+                      RetxSuppressionExponential::DEFAULT_MULTIPLIER,
+                      RETX_SUPPRESSION_MAX)
+  , m_rng(ns3::CreateObject<ns3::UniformRandomVariable>())
+{
+  ParsedInstanceName parsed = parseInstanceName(name);
+  if (!parsed.parameters.empty()) {
+    processParams(parsed.parameters);
+  }
+
+  if (parsed.version && *parsed.version != getStrategyName()[-1].toVersion()) {
+    NDN_THROW(std::invalid_argument(
+      "PfGeoStrategy does not support version " + to_string(*parsed.version)));
+  }
+  this->setInstanceName(makeInstanceName(name, getStrategyName()));
+  this->enableRebroadcastDecision(true);
+
+  NFD_LOG_DEBUG("probability=" << m_probability << " retx=" << m_retxThreshold
+                << " diameter-slack=" << m_diameterSlack);
+}
+
+const Name&
+PfGeoStrategy::getStrategyName()
+{
+  static Name strategyName("/localhost/nfd/strategy/pf-geo/%FD%01");
+  return strategyName;
+}
+
+template<typename T>
+static T
+getParamValue(const std::string& param, const std::string& value)
+{
+  try {
+    if (!value.empty() && value[0] == '-')
+      NDN_THROW(boost::bad_lexical_cast());
+
+    return boost::lexical_cast<T>(value);
+  }
+  catch (const boost::bad_lexical_cast&) {
+    NDN_THROW(std::invalid_argument("Value of " + param + " must be a non-negative number"));
+  }
+}
+
+void
+PfGeoStrategy::processParams(const PartialName& parsed)
+{
+  for (const auto& component : parsed) {
+    std::string parsedStr(reinterpret_cast<const char*>(component.value()), component.value_size());
+    auto n = parsedStr.find("~");
+    if (n == std::string::npos) {
+      NDN_THROW(std::invalid_argument("Format is <parameter>~<value>"));
+    }
+
+    auto f = parsedStr.substr(0, n);
+    auto s = parsedStr.substr(n + 1);
+    if (f == "probability") {
+      m_probability = getParamValue<double>(f, s);
+      if (m_probability > 1.0) {
+        NDN_THROW(std::invalid_argument("Value of probability must be in [0, 1]"));
+      }
+    }
+    else if (f == "retx") {
+      m_retxThreshold = getParamValue<uint32_t>(f, s);
+    }
+    else if (f == "diameter-slack") {
+      m_diameterSlack = getParamValue<uint32_t>(f, s);
+    }
+    else {
+      NDN_THROW(std::invalid_argument("Parameter should be probability, retx, or diameter-slack"));
+    }
+  }
+}
+
+bool
+PfGeoStrategy::shouldRebroadcast(const Interest& interest, bool& bypassSuppression)
+{
+  uint32_t diameter = 0;
+  uint32_t retx = 0;
+  auto geoTag = interest.getTag<lp::GeoTag>();
+  if (geoTag != nullptr) {
+    std::tie(diameter, retx, std::ignore) = geoTag->getPos();
+  }
+
+  uint64_t hopCount = 0;
+  auto hopCountTag = interest.getTag<lp::HopCountTag>();
+  if (hopCountTag != nullptr) {
+    hopCount = *hopCountTag;
+  }
+
+  // beyond the known distance between consumer and producer
+  if (diameter > 0 && hopCount > static_cast<uint64_t>(diameter) + m_diameterSlack) {
+    return false;
+  }
+
+  // repeatedly retransmitted by the consumer: flood reliably
+  if (retx >= m_retxThreshold) {
+    bypassSuppression = true;
+    return true;
+  }
+
+  return m_rng->GetValue() <= m_probability;
+}
+
+void
+PfGeoStrategy::afterReceiveInterest(const FaceEndpoint& ingress, const Interest& interest,
+                                    const shared_ptr<pit::Entry>& pitEntry)
+{
+  const fib::Entry& fibEntry = this->lookupFib(*pitEntry);
+  const fib::NextHopList& nexthops = fibEntry.getNextHops();
+
+  int nEligibleNextHops = 0;
+  bool isSuppressed = false;
+
+  for (const auto& nexthop : nexthops) {
+    Face& outFace = nexthop.getFace();
+
+    bool isRebroadcast = outFace.getId() == ingress.face.getId();
+    if ((isRebroadcast && outFace.getLinkType() != ndn::nfd::LINK_TYPE_AD_HOC) ||
+        wouldViolateScope(ingress.face, interest, outFace)) {
+      continue;
+    }
+
+    bool bypassSuppression = false;
+    if (isRebroadcast && !shouldRebroadcast(interest, bypassSuppression)) {
+      NFD_LOG_DEBUG(interest << " from=" << ingress << " to=" << outFace.getId() << " not-rebroadcast");
+      // neighbours may still answer; keep the PIT entry pending instead of Nacking
+      isSuppressed = true;
+      continue;
+    }
+
+    RetxSuppressionResult suppressResult = RetxSuppressionResult::NEW;
+    if (!bypassSuppression) {
+      suppressResult = m_retxSuppression.decidePerUpstream(*pitEntry, outFace);
+      if (suppressResult == RetxSuppressionResult::SUPPRESS) {
+        NFD_LOG_DEBUG(interest << " from=" << ingress << " to=" << outFace.getId() << " suppressed");
+        isSuppressed = true;
+        continue;
+      }
+    }
+
+    this->sendInterest(pitEntry, FaceEndpoint(outFace, 0), interest);
+    NFD_LOG_DEBUG(interest << " from=" << ingress << " pitEntry-to=" << outFace.getId());
+
+    if (suppressResult == RetxSuppressionResult::FORWARD) {
+      m_retxSuppression.incrementIntervalForOutRecord(*pitEntry->getOutRecord(outFace));
+    }
+    ++nEligibleNextHops;
+  }
+
+  if (nEligibleNextHops == 0 && !isSuppressed) {
+    NFD_LOG_DEBUG(interest << " from=" << ingress << " noNextHop");
+
+    lp::NackHeader nackHeader;
+    nackHeader.setReason(lp::NackReason::NO_ROUTE);
+    this->sendNack(pitEntry, ingress, nackHeader);
+
+    this->rejectPendingInterest(pitEntry);
+  }
+}
+
+void
+PfGeoStrategy::afterReceiveNack(const FaceEndpoint& ingress, const lp::Nack& nack,
+                                const shared_ptr<pit::Entry>& pitEntry)
+{
+  this->processNack(ingress.face, nack, pitEntry);
+}
+
+int64_t
+PfGeoStrategy::assignStreams(int64_t stream)
+{
+  m_rng->SetStream(stream);
+  return 1;
+}
+
+} // namespace fw
+} // namespace nfd
@@ -0,0 +1,123 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_PF_GEO_STRATEGY_HPP
+#define NFD_DAEMON_FW_PF_GEO_STRATEGY_HPP
+
+#include "strategy.hpp"
+#include "process-nack-traits.hpp"
+#include "retx-suppression-exponential.hpp"
+
+#include "ns3/ptr.h"
+#include "ns3/random-variable-stream.h"
+
+namespace nfd {
+namespace fw {
+
+/** \brief a probabilistic flooding strategy for broadcast (ad hoc) wireless faces
+ *
+ *  Interests are forwarded to all FIB nexthops, as in MulticastStrategy.  When an Interest
+ *  received on an ad hoc face would be sent back to the same face (re-broadcast), the
+ *  decision uses the GeoTag tuple `(diameter, RETX count, diameter)` set by the consumer:
+ *  - if the diameter is known (non-zero) and HopCount exceeds it by more than
+ *    `diameter-slack`, the Interest is not re-broadcast;
+ *  - if the consumer retransmitted the Interest at least `retx` times, it is always
+ *    re-broadcast, bypassing retransmission suppression;
+ *  - otherwise it is re-broadcast with probability `probability`.
+ *
+ *  Parameters are given in the instance name, e.g.
+ *  `/localhost/nfd/strategy/pf-geo/%FD%01/probability~0.85/retx~2/diameter-slack~0`
+ *
+ *  Forwarder does not apply its own RebroadcastProbability to the Interests of this strategy.
+ *
+ *  \note This strategy is not EndpointId-aware.
+ */
+class PfGeoStrategy : public Strategy
+                    , public ProcessNackTraits<PfGeoStrategy>
+{
+public:
+  explicit
+  PfGeoStrategy(Forwarder& forwarder, const Name& name = getStrategyName());
+
+  static const Name&
+  getStrategyName();
+
+  void
+  afterReceiveInterest(const FaceEndpoint& ingress, const Interest& interest,
+                       const shared_ptr<pit::Entry>& pitEntry) override;
+
+  void
+  afterReceiveNack(const FaceEndpoint& ingress, const lp::Nack& nack,
+                   const shared_ptr<pit::Entry>& pitEntry) override;
+
+  int64_t
+  assignStreams(int64_t stream) override;
+
+  double
+  getProbability() const
+  {
+    return m_probability;
+  }
+
+  uint32_t
+  getRetxThreshold() const
+  {
+    return m_retxThreshold;
+  }
+
+  uint32_t
+  getDiameterSlack() const
+  {
+    return m_diameterSlack;
+  }
+
+private:
+  void
+  processParams(const PartialName& parsed);
+
+  /** \brief decide whether an Interest received on ad hoc face should be re-broadcast on it
+   *  \return true to forward, false to drop
+   */
+  bool
+  shouldRebroadcast(const Interest& interest, bool& bypassSuppression);
+
+private:
+  friend ProcessNackTraits<PfGeoStrategy>;
+  RetxSuppressionExponential m_retxSuppression;
+
+  double m_probability = 0.85;
+  uint32_t m_retxThreshold = 2;
+  uint32_t m_diameterSlack = 0;
+  ns3::Ptr<ns3::UniformRandomVariable> m_rng;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  static const time::microseconds RETX_SUPPRESSION_INITIAL;
+  static const time::milliseconds RETX_SUPPRESSION_MAX;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_PF_GEO_STRATEGY_HPP
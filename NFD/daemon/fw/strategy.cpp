@@ -163,6 +163,12 @@ Strategy::Strategy(Forwarder& forwarder)
 
 Strategy::~Strategy() = default;
 
+int64_t
+Strategy::assignStreams(int64_t stream)
+{
+  return 0;
+}
+
 
 void
 Strategy::afterReceiveLoopedInterest(const FaceEndpoint& ingress, const Interest& interest,
@@ -122,6 +122,26 @@ public: // constructor, destructor, strategy info
     return m_wantNewNextHopTrigger;
   }
 
+  /** \return whether this strategy decides itself whether an Interest received on the
+   *          broadcast face is re-broadcast on it, so that Forwarder does not apply its
+   *          RebroadcastProbability on top of the decision.
+   */
+  bool
+  decidesRebroadcast() const
+  {
+    return m_decidesRebroadcast;
+  }
+
+  /** \brief assign fixed random variable stream numbers to the random variables used by
+   *         this strategy
+   *  \param stream first stream index to use
+   *  \return number of stream indices assigned
+   *
+   *  In the base class, this method assigns no stream.
+   */
+  virtual int64_t
+  assignStreams(int64_t stream);
+
 public: // triggers
   /** \brief trigger after Interest is received
    *
@@ -406,6 +426,15 @@ PUBLIC_WITH_TESTS_ELSE_PROTECTED: // setter
     m_wantNewNextHopTrigger = enabled;
   }
 
+  /** \brief set whether this strategy decides itself whether an Interest received on the
+   *         broadcast face is re-broadcast on it
+   */
+  void
+  enableRebroadcastDecision(bool enabled)
+  {
+    m_decidesRebroadcast = enabled;
+  }
+
 private: // registry
   typedef std::function<unique_ptr<Strategy>(Forwarder& forwarder, const Name& strategyName)> CreateFunc;
   typedef std::map<Name, CreateFunc> Registry; // indexed by strategy name
@@ -432,6 +461,7 @@ private: // instance fields
   MeasurementsAccessor m_measurements;
 
   bool m_wantNewNextHopTrigger = false;
+  bool m_decidesRebroadcast = false;
 };
 
 } // namespace fw
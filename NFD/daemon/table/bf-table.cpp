@@ -0,0 +1,179 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "bf-table.hpp"
+#include "common/logger.hpp"
+
+#include <ns3/simulator.h>
+
+namespace nfd {
+
+NFD_LOG_INIT(BfTable);
+
+const int BfTable::BF_DELAY = 400000;
+
+BfTable::~BfTable()
+{
+  m_checkEvent.Cancel();
+}
+
+BfTable::Table::Record*
+BfTable::find(const Name& name, uint32_t input, uint32_t output, uint32_t IoD)
+{
+  return m_table.find(name, name_tree::computeHash(name), [=] (const Value& v) {
+    return v.input == input && v.output == output && v.IoD == IoD;
+  });
+}
+
+void
+BfTable::insert(const Name& name, uint32_t input, uint32_t output, bool isAnyOutput, uint32_t IoD)
+{
+  name_tree::HashValue h = name_tree::computeHash(name);
+  Table::Record* record = m_table.find(name, h, [=] (const Value& v) {
+    return v.input == input && (isAnyOutput || v.output == output) && v.IoD == IoD;
+  });
+
+  if (record != nullptr) {
+    ++record->value.counter;
+    return;
+  }
+
+  m_table.insert(name, h, ns3::Simulator::Now(), {1, input, output, IoD}, IoD == 1 || IoD == 2);
+  NFD_LOG_TRACE("insert " << name << " input=" << input << " output=" << output << " IoD=" << IoD);
+}
+
+void
+BfTable::insert1(const Name& name, uint32_t input, uint32_t IoD)
+{
+  this->insert(name, input, 0, true, IoD);
+}
+
+void
+BfTable::insert2(const Name& name, uint32_t input, uint32_t output, uint32_t IoD)
+{
+  if (!m_checkEvent.IsRunning()) {
+    this->checkExpired();
+  }
+
+  this->insert(name, input, output, false, IoD);
+}
+
+uint32_t
+BfTable::getCounter1(const Name& name, uint32_t, uint32_t IoD)
+{
+  Table::Record* record = m_table.find(name, name_tree::computeHash(name), [=] (const Value& v) {
+    return v.input == 257 && v.IoD == IoD;
+  });
+
+  if (record == nullptr) {
+    NFD_LOG_DEBUG("getCounter1 not-found " << name);
+    return 0;
+  }
+  return record->value.counter;
+}
+
+uint32_t
+BfTable::getCounter2(const Name& name, uint32_t input, uint32_t output, uint32_t IoD)
+{
+  Table::Record* record = this->find(name, input, output, IoD);
+  return record == nullptr ? 0 : record->value.counter;
+}
+
+uint32_t
+BfTable::getInput1(const Name& name, uint32_t IoD)
+{
+  Table::Record* record = m_table.find(name, name_tree::computeHash(name), [=] (const Value& v) {
+    return v.input != 0 && v.IoD == IoD;
+  });
+
+  if (record == nullptr) {
+    NFD_LOG_DEBUG("getInput1 not-found " << name);
+    return 10000;
+  }
+  return record->value.input;
+}
+
+uint32_t
+BfTable::getInput2(const Name& name, uint32_t input, uint32_t output, uint32_t IoD)
+{
+  Table::Record* record = this->find(name, input, output, IoD);
+  return record == nullptr ? 10000 : record->value.input;
+}
+
+uint32_t
+BfTable::getOutput2(const Name& name, uint32_t input, uint32_t output, uint32_t IoD)
+{
+  Table::Record* record = this->find(name, input, output, IoD);
+  return record == nullptr ? 10000 : record->value.output;
+}
+
+void
+BfTable::lock(const Name& name, uint32_t input, uint32_t output, uint32_t IoD)
+{
+  if (this->find(name, input, output, IoD) == nullptr) {
+    NFD_LOG_DEBUG("lock not-found " << name);
+  }
+}
+
+void
+BfTable::erase1(const Name& name, uint32_t input, uint32_t IoD)
+{
+  Table::Record* record = m_table.find(name, name_tree::computeHash(name), [=] (const Value& v) {
+    return v.input == input && v.IoD == IoD && v.counter == 1;
+  });
+
+  if (record == nullptr) {
+    NFD_LOG_DEBUG("erase1 not-found " << name);
+    return;
+  }
+  m_table.erase(*record);
+}
+
+void
+BfTable::erase2(const Name& name, uint32_t input, uint32_t output, uint32_t IoD)
+{
+  Table::Record* record = this->find(name, input, output, IoD);
+  if (record == nullptr) {
+    NFD_LOG_DEBUG("erase2 not-found " << name);
+    return;
+  }
+  m_table.erase(*record);
+}
+
+void
+BfTable::checkExpired()
+{
+  int64_t now = ns3::Simulator::Now().GetMilliSeconds();
+  size_t nExpired = m_table.expire([now] (const Table::Record& record) {
+    return now - record.timestamp.GetMilliSeconds() > BF_DELAY;
+  });
+  NFD_LOG_TRACE("expired " << nExpired);
+
+  m_checkEvent.Cancel();
+  m_checkEvent = ns3::Simulator::Schedule(ns3::MilliSeconds(BF_DELAY + 0.01),
+                                          &BfTable::checkExpired, this);
+}
+
+} // namespace nfd
@@ -0,0 +1,146 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_BF_TABLE_HPP
+#define NFD_DAEMON_TABLE_BF_TABLE_HPP
+
+#include "soft-state-table.hpp"
+
+#include "ns3/event-id.h"
+
+namespace nfd {
+
+/** \brief BF records of a forwarder
+ *
+ *  A BF record counts packets of a name seen on an input face, optionally paired with an
+ *  output face, for Interests (IoD == 1) or Data (IoD == 2). Records are kept for BF_DELAY
+ *  after they are created. Once the first record with an output face is inserted, expired
+ *  records are checked for every BF_DELAY.
+ *
+ *  The records used to be stored as extra nodes of the NameTree hashtable. They are kept in
+ *  their own table so that lookups of regular name tree entries do not traverse them.
+ */
+class BfTable : noncopyable
+{
+public:
+  ~BfTable();
+
+  /** \return number of records
+   */
+  size_t
+  size() const
+  {
+    return m_table.size();
+  }
+
+  /** \brief increment the counter of the record (name, input, any output, IoD),
+   *         or insert the record with counter 1 and no output face
+   */
+  void
+  insert1(const Name& name, uint32_t input, uint32_t IoD);
+
+  /** \brief increment the counter of the record (name, input, output, IoD),
+   *         or insert the record with counter 1
+   */
+  void
+  insert2(const Name& name, uint32_t input, uint32_t output, uint32_t IoD);
+
+  /** \return counter of the record (name, 257, any output, IoD), or 0 if it does not exist
+   *  \note Records are looked up on the broadcast face, regardless of \p input.
+   */
+  uint32_t
+  getCounter1(const Name& name, uint32_t input, uint32_t IoD);
+
+  /** \return counter of the record (name, input, output, IoD), or 0 if it does not exist
+   */
+  uint32_t
+  getCounter2(const Name& name, uint32_t input, uint32_t output, uint32_t IoD);
+
+  /** \return input face of a record (name, any input, any output, IoD),
+   *          or 10000 if it does not exist
+   */
+  uint32_t
+  getInput1(const Name& name, uint32_t IoD);
+
+  /** \return input face of the record (name, input, output, IoD), or 10000 if it does not exist
+   */
+  uint32_t
+  getInput2(const Name& name, uint32_t input, uint32_t output, uint32_t IoD);
+
+  /** \return output face of the record (name, input, output, IoD), or 10000 if it does not exist
+   */
+  uint32_t
+  getOutput2(const Name& name, uint32_t input, uint32_t output, uint32_t IoD);
+
+  /** \brief check that the record (name, input, output, IoD) exists
+   */
+  void
+  lock(const Name& name, uint32_t input, uint32_t output, uint32_t IoD);
+
+  /** \brief erase the record (name, input, any output, IoD) if its counter is 1
+   */
+  void
+  erase1(const Name& name, uint32_t input, uint32_t IoD);
+
+  /** \brief erase the record (name, input, output, IoD)
+   */
+  void
+  erase2(const Name& name, uint32_t input, uint32_t output, uint32_t IoD);
+
+  /** \brief erase expired records and schedule the next check
+   */
+  void
+  checkExpired();
+
+public:
+  /** \brief lifetime of a record, in milliseconds
+   */
+  static const int BF_DELAY;
+
+private:
+  struct Value
+  {
+    uint32_t counter;
+    uint32_t input;
+    uint32_t output;
+    uint32_t IoD;
+  };
+
+  using Table = SoftStateTable<Value>;
+
+  void
+  insert(const Name& name, uint32_t input, uint32_t output, bool isAnyOutput, uint32_t IoD);
+
+  Table::Record*
+  find(const Name& name, uint32_t input, uint32_t output, uint32_t IoD);
+
+private:
+  Table m_table;
+  ns3::EventId m_checkEvent;
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_BF_TABLE_HPP
@@ -25,16 +25,59 @@
 
 #include "cs-entry.hpp"
 
+#include <cstring>
+
 namespace nfd {
 namespace cs {
 
-Entry::Entry(shared_ptr<const Data> data, bool isUnsolicited)
-  : m_data(std::move(data))
+Entry::Entry(shared_ptr<const Data> data, bool isUnsolicited, bool isWireOnly)
+  : m_freshnessPeriod(data->getFreshnessPeriod())
   , m_isUnsolicited(isUnsolicited)
 {
+  if (isWireOnly) {
+    const Block& wire = data->wireEncode();
+    m_wireData = make_unique<WireData>();
+    // a Block over the same buffer, without the parsed elements of the Data's wire
+    m_wireData->wire = Block(wire, wire.begin(), wire.end());
+    m_wireData->name = data->getName();
+    const name::Component& digest = data->getFullName()[-1];
+    std::copy(digest.value_begin(), digest.value_end(), m_wireData->digest.begin());
+  }
+  else {
+    m_data = std::move(data);
+  }
   updateFreshUntil();
 }
 
+shared_ptr<const Data>
+Entry::getData() const
+{
+  if (m_data != nullptr) {
+    return m_data;
+  }
+  return make_shared<Data>(m_wireData->wire);
+}
+
+Name
+Entry::getFullName() const
+{
+  if (m_data != nullptr) {
+    return m_data->getFullName();
+  }
+  Name fullName = m_wireData->name;
+  fullName.appendImplicitSha256Digest(m_wireData->digest.data(), m_wireData->digest.size());
+  return fullName;
+}
+
+const uint8_t*
+Entry::getDigest() const
+{
+  if (m_data != nullptr) {
+    return m_data->getFullName()[-1].value();
+  }
+  return m_wireData->digest.data();
+}
+
 bool
 Entry::isFresh() const
 {
@@ -44,38 +87,69 @@ Entry::isFresh() const
 void
 Entry::updateFreshUntil()
 {
-  m_freshUntil = time::steady_clock::now() + m_data->getFreshnessPeriod();
+  m_freshUntil = time::steady_clock::now() + m_freshnessPeriod;
 }
 
 bool
 Entry::canSatisfy(const Interest& interest) const
 {
-  if (!interest.matchesData(*m_data)) {
+  // same as interest.matchesData(data), without requiring the decoded Data
+  const Name& interestName = interest.getName();
+  const Name& dataName = getName();
+
+  if (interestName.size() == dataName.size() + 1) {
+    if (!interestName[-1].isImplicitSha256Digest() ||
+        interestName.compare(0, dataName.size(), dataName) != 0 ||
+        std::memcmp(interestName[-1].value(), getDigest(), util::Sha256::DIGEST_SIZE) != 0) {
+      return false;
+    }
+  }
+  else if (interest.getCanBePrefix() ? !interestName.isPrefixOf(dataName) : interestName != dataName) {
     return false;
   }
 
-  if (interest.getMustBeFresh() && !this->isFresh()) {
+  if (interest.getMustBeFresh() && (m_freshnessPeriod <= 0_ms || !this->isFresh())) {
     return false;
   }
 
   return true;
 }
 
+size_t
+Entry::getMemoryUsage() const
+{
+  // red-black tree node: color, parent, left and right
+  size_t nBytes = sizeof(Entry) + 4 * sizeof(void*);
+
+  if (m_data != nullptr) {
+    const Block& wire = m_data->wireEncode();
+    // Name and full Name components, parsed elements of the wire encoding
+    nBytes += sizeof(Data) + wire.size() +
+              (2 * m_data->getName().size() + 1) * sizeof(name::Component) +
+              wire.elements_size() * sizeof(Block);
+  }
+  else {
+    nBytes += sizeof(WireData) + m_wireData->wire.size() +
+              m_wireData->name.size() * sizeof(name::Component);
+  }
+  return nBytes;
+}
+
 static int
-compareQueryWithData(const Name& queryName, const Data& data)
+compareQueryWithData(const Name& queryName, const Entry& entry)
 {
   bool queryIsFullName = !queryName.empty() && queryName[-1].isImplicitSha256Digest();
 
   int cmp = queryIsFullName ?
-            queryName.compare(0, queryName.size() - 1, data.getName()) :
-            queryName.compare(data.getName());
+            queryName.compare(0, queryName.size() - 1, entry.getName()) :
+            queryName.compare(entry.getName());
 
   if (cmp != 0) { // Name without digest differs
     return cmp;
   }
 
   if (queryIsFullName) { // Name without digest equals, compare digest
-    return queryName[-1].compare(data.getFullName()[-1]);
+    return std::memcmp(queryName[-1].value(), entry.getDigest(), util::Sha256::DIGEST_SIZE);
   }
   else { // queryName is a proper prefix of Data fullName
     return -1;
@@ -83,32 +157,32 @@ compareQueryWithData(const Name& queryName, const Data& data)
 }
 
 static int
-compareDataWithData(const Data& lhs, const Data& rhs)
+compareDataWithData(const Entry& lhs, const Entry& rhs)
 {
   int cmp = lhs.getName().compare(rhs.getName());
   if (cmp != 0) {
     return cmp;
   }
 
-  return lhs.getFullName()[-1].compare(rhs.getFullName()[-1]);
+  return std::memcmp(lhs.getDigest(), rhs.getDigest(), util::Sha256::DIGEST_SIZE);
 }
 
 bool
 operator<(const Entry& entry, const Name& queryName)
 {
-  return compareQueryWithData(queryName, entry.getData()) > 0;
+  return compareQueryWithData(queryName, entry) > 0;
 }
 
 bool
 operator<(const Name& queryName, const Entry& entry)
 {
-  return compareQueryWithData(queryName, entry.getData()) < 0;
+  return compareQueryWithData(queryName, entry) < 0;
 }
 
 bool
 operator<(const Entry& lhs, const Entry& rhs)
 {
-  return compareDataWithData(lhs.getData(), rhs.getData()) < 0;
+  return compareDataWithData(lhs, rhs) < 0;
 }
 
 } // namespace cs
@@ -30,36 +30,49 @@
 
 #include "../src/ndnSIM/ndn-cxx/ndn-cxx/selectors.hpp"
 
+#include <ndn-cxx/util/sha256.hpp>
+
+#include <boost/pool/pool_alloc.hpp>
+
+#include <array>
+
 namespace nfd {
 namespace cs {
 
 /** \brief a ContentStore entry
+ *
+ *  An entry either holds the Data packet, or, with wire-only storage, only its wire encoding,
+ *  its Name and implicit digest, from which the Data is decoded on demand.
  */
 class Entry
 {
 public: // exposed through ContentStore enumeration
   /** \brief return the stored Data
+   *  \note With wire-only storage, the Data is decoded from its wire encoding on every call,
+   *        and packet tags of the inserted Data are not retained.
    */
-  const Data&
-  getData() const
-  {
-    return *m_data;
-  }
+  shared_ptr<const Data>
+  getData() const;
 
   /** \brief return stored Data name
    */
   const Name&
   getName() const
   {
-    return m_data->getName();
+    return m_data != nullptr ? m_data->getName() : m_wireData->name;
   }
 
   /** \brief return full name (including implicit digest) of the stored Data
    */
-  const Name&
-  getFullName() const
+  Name
+  getFullName() const;
+
+  /** \brief return FreshnessPeriod of the stored Data
+   */
+  time::milliseconds
+  getFreshnessPeriod() const
   {
-    return m_data->getFullName();
+    return m_freshnessPeriod;
   }
 
   /** \brief return whether the stored Data is unsolicited
@@ -70,6 +83,14 @@ public: // exposed through ContentStore enumeration
     return m_isUnsolicited;
   }
 
+  /** \brief return whether only the wire encoding of the Data is stored
+   */
+  bool
+  isWireOnly() const
+  {
+    return m_data == nullptr;
+  }
+
   /** \brief check if the stored Data is fresh now
    */
   bool
@@ -80,8 +101,19 @@ public: // exposed through ContentStore enumeration
   bool
   canSatisfy(const Interest& interest) const;
 
+  /** \brief return an estimate of the memory held by this entry and its Table node, in bytes
+   *
+   *  Wire buffers are counted with the size of the Data, even if they are shared.
+   */
+  size_t
+  getMemoryUsage() const;
+
 public: // used by ContentStore implementation
-  Entry(shared_ptr<const Data> data, bool isUnsolicited);
+  /** \param data the Data packet
+   *  \param isUnsolicited whether the Data is unsolicited
+   *  \param isWireOnly whether to store only the wire encoding of \p data
+   */
+  Entry(shared_ptr<const Data> data, bool isUnsolicited, bool isWireOnly = false);
 
   /** \brief recalculate when the entry would become non-fresh, relative to current time
    */
@@ -96,10 +128,27 @@ public: // used by ContentStore implementation
     m_isUnsolicited = false;
   }
 
+  /** \brief return the value of the implicit digest of the stored Data
+   *  \return a pointer to util::Sha256::DIGEST_SIZE octets
+   */
+  const uint8_t*
+  getDigest() const;
+
 private:
-  shared_ptr<const Data> m_data;
-  bool m_isUnsolicited;
+  /** \brief the parts of a Data packet kept with wire-only storage
+   */
+  struct WireData
+  {
+    Block wire;
+    Name name;
+    std::array<uint8_t, util::Sha256::DIGEST_SIZE> digest;
+  };
+
+  shared_ptr<const Data> m_data; ///< the Data, nullptr with wire-only storage
+  unique_ptr<WireData> m_wireData; ///< the Data's wire encoding, with wire-only storage
+  time::milliseconds m_freshnessPeriod;
   time::steady_clock::TimePoint m_freshUntil;
+  bool m_isUnsolicited;
 };
 
 bool
@@ -114,8 +163,12 @@ operator<(const Entry& lhs, const Entry& rhs);
 /** \brief an ordered container of ContentStore entries
  *
  *  This container uses std::less<> comparator to enable lookup with queryName.
+ *  Its nodes are allocated from a pool shared by all Content Stores, without locking,
+ *  which avoids the per-allocation overhead of the general-purpose allocator.
  */
-using Table = std::set<Entry, std::less<>>;
+using Table = std::set<Entry, std::less<>,
+                       boost::fast_pool_allocator<Entry, boost::default_user_allocator_new_delete,
+                                                  boost::details::pool::null_mutex>>;
 
 inline bool
 operator<(Table::const_iterator lhs, Table::const_iterator rhs)
@@ -49,6 +49,19 @@ Cs::Cs(size_t nMaxPackets)
 
 void
 Cs::insert(const Data& data, bool isUnsolicited)
+{
+  this->insertImpl(data, isUnsolicited, name_tree::computeHash(data.getName()));
+}
+
+void
+Cs::insert(const Data& data, const name_tree::HashSequence& hashes, bool isUnsolicited)
+{
+  BOOST_ASSERT(hashes.size() == data.getName().size() + 1);
+  this->insertImpl(data, isUnsolicited, hashes.back());
+}
+
+void
+Cs::insertImpl(const Data& data, bool isUnsolicited, size_t nameHash)
 {
   if (!m_shouldAdmit || m_policy->getLimit() == 0) {
     return;
@@ -66,7 +79,7 @@ Cs::insert(const Data& data, bool isUnsolicited)
 
   const_iterator it;
   bool isNewEntry = false;
-  std::tie(it, isNewEntry) = m_table.emplace(data.shared_from_this(), isUnsolicited);
+  std::tie(it, isNewEntry) = m_table.emplace(data.shared_from_this(), isUnsolicited, m_isWireOnly);
   Entry& entry = const_cast<Entry&>(*it);
 
   entry.updateFreshUntil();
@@ -80,6 +93,7 @@ Cs::insert(const Data& data, bool isUnsolicited)
     m_policy->afterRefresh(it);
   }
   else {
+    afterInsertEntry(it, nameHash);
     m_policy->afterInsert(it);
   }
 }
@@ -104,6 +118,7 @@ Cs::eraseImpl(const Name& prefix, size_t limit)
   size_t nErased = 0;
   while (i != last && nErased < limit) {
     m_policy->beforeErase(i);
+    beforeEraseEntry(i);
     i = m_table.erase(i);
     ++nErased;
   }
@@ -111,18 +126,27 @@ Cs::eraseImpl(const Name& prefix, size_t limit)
 }
 
 Cs::const_iterator
-Cs::findImpl(const Interest& interest) const
+Cs::findImpl(const Interest& interest, const name_tree::HashSequence* hashes) const
 {
   if (!m_shouldServe || m_policy->getLimit() == 0) {
     return m_table.end();
   }
 
   const Name& prefix = interest.getName();
-  auto range = findPrefixRange(prefix);
-  auto match = std::find_if(range.first, range.second,
-                            [&interest] (const auto& entry) { return entry.canSatisfy(interest); });
+  const_iterator match;
+  if (!interest.getCanBePrefix()) {
+    match = findExact(interest, hashes);
+  }
+  else {
+    auto range = findPrefixRange(prefix);
+    match = std::find_if(range.first, range.second,
+                         [&interest] (const auto& entry) { return entry.canSatisfy(interest); });
+    if (match == range.second) {
+      match = m_table.end();
+    }
+  }
 
-  if (match == range.second) {
+  if (match == m_table.end()) {
     NFD_LOG_DEBUG("find " << prefix << " no-match");
     return m_table.end();
   }
@@ -131,6 +155,52 @@ Cs::findImpl(const Interest& interest) const
   return match;
 }
 
+Cs::const_iterator
+Cs::findExact(const Interest& interest, const name_tree::HashSequence* hashes) const
+{
+  const Name& name = interest.getName();
+  size_t nameLen = name.size();
+  if (nameLen > 0 && name[-1].isImplicitSha256Digest()) {
+    --nameLen;
+  }
+
+  // Among the entries with this name, return the first one in Table order, as a scan of the
+  // prefix range would
+  auto match = m_table.end();
+  size_t nameHash = hashes == nullptr ? name_tree::computeHash(name, nameLen) : (*hashes)[nameLen];
+  auto range = m_index.equal_range(nameHash);
+  for (auto i = range.first; i != range.second; ++i) {
+    const_iterator it = i->second;
+    if (it->getName().size() == nameLen && name.compare(0, nameLen, it->getName()) == 0 &&
+        (match == m_table.end() || *it < *match) && it->canSatisfy(interest)) {
+      match = it;
+    }
+  }
+  return match;
+}
+
+void
+Cs::afterInsertEntry(const_iterator it, size_t nameHash)
+{
+  m_index.emplace(nameHash, it);
+  m_memoryUsage += it->getMemoryUsage();
+}
+
+void
+Cs::beforeEraseEntry(const_iterator it)
+{
+  m_memoryUsage -= it->getMemoryUsage();
+
+  auto range = m_index.equal_range(name_tree::computeHash(it->getName()));
+  for (auto i = range.first; i != range.second; ++i) {
+    if (i->second == it) {
+      m_index.erase(i);
+      return;
+    }
+  }
+  BOOST_ASSERT_MSG(false, "CS entry missing from the exact-match index");
+}
+
 void
 Cs::dump()
 {
@@ -155,7 +225,10 @@ Cs::setPolicyImpl(unique_ptr<Policy> policy)
 {
   NFD_LOG_DEBUG("set-policy " << policy->getName());
   m_policy = std::move(policy);
-  m_beforeEvictConnection = m_policy->beforeEvict.connect([this] (auto it) { m_table.erase(it); });
+  m_beforeEvictConnection = m_policy->beforeEvict.connect([this] (auto it) {
+    beforeEraseEntry(it);
+    m_table.erase(it);
+  });
 
   m_policy->setCs(this);
   BOOST_ASSERT(m_policy->getCs() == this);
@@ -181,5 +254,15 @@ Cs::enableServe(bool shouldServe)
   NFD_LOG_INFO((shouldServe ? "Enabling" : "Disabling") << " Data serving");
 }
 
+void
+Cs::enableWireOnly(bool isWireOnly)
+{
+  if (m_isWireOnly == isWireOnly) {
+    return;
+  }
+  m_isWireOnly = isWireOnly;
+  NFD_LOG_INFO((isWireOnly ? "Enabling" : "Disabling") << " wire-only storage");
+}
+
 } // namespace cs
 } // namespace nfd
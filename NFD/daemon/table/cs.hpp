@@ -27,6 +27,9 @@
 #define NFD_DAEMON_TABLE_CS_HPP
 
 #include "cs-policy.hpp"
+#include "name-tree-hashtable.hpp"
+
+#include <unordered_map>
 
 namespace nfd {
 namespace cs {
@@ -52,6 +55,12 @@ public:
   void
   insert(const Data& data, bool isUnsolicited = false);
 
+  /** \brief inserts a Data packet, with precomputed hashes of its name
+   *  \pre hashes == name_tree::computeHashes(data.getName())
+   */
+  void
+  insert(const Data& data, const name_tree::HashSequence& hashes, bool isUnsolicited = false);
+
   /** \brief asynchronously erases entries under \p prefix
    *  \tparam AfterEraseCallback `void f(size_t nErased)`
    *  \param prefix name prefix of entries
@@ -80,12 +89,29 @@ public:
   void
   find(const Interest& interest, HitCallback&& hit, MissCallback&& miss) const
   {
-    auto match = findImpl(interest);
+    auto match = findImpl(interest, nullptr);
     if (match == m_table.end()) {
       miss(interest);
       return;
     }
-    hit(interest, match->getData());
+    hit(interest, *match->getData());
+  }
+
+  /** \brief finds the best matching Data packet, with precomputed hashes of the Interest name
+   *  \pre hashes == name_tree::computeHashes(interest.getName())
+   *  \sa find(const Interest&, HitCallback&&, MissCallback&&)
+   */
+  template<typename HitCallback, typename MissCallback>
+  void
+  find(const Interest& interest, const name_tree::HashSequence& hashes,
+       HitCallback&& hit, MissCallback&& miss) const
+  {
+    auto match = findImpl(interest, &hashes);
+    if (match == m_table.end()) {
+      miss(interest);
+      return;
+    }
+    hit(interest, *match->getData());
   }
 
   /** \brief get number of stored packets
@@ -96,6 +122,15 @@ public:
     return m_table.size();
   }
 
+  /** \brief get an estimate of the memory held by the stored packets, in bytes
+   *  \sa Entry::getMemoryUsage
+   */
+  size_t
+  getMemoryUsage() const
+  {
+    return m_memoryUsage;
+  }
+
 public: // configuration
   /** \brief get capacity (in number of packets)
    */
@@ -157,6 +192,22 @@ public: // configuration
   void
   enableServe(bool shouldServe);
 
+  /** \brief get whether newly inserted Data are stored as wire encoding only
+   */
+  bool
+  isWireOnly() const
+  {
+    return m_isWireOnly;
+  }
+
+  /** \brief set whether newly inserted Data are stored as wire encoding only
+   *
+   *  Wire-only entries keep the wire encoding, Name and implicit digest of the Data, which is
+   *  decoded again when it is found.  Existing entries are not converted.
+   */
+  void
+  enableWireOnly(bool isWireOnly);
+
 public: // enumeration
   using const_iterator = Table::const_iterator;
 
@@ -176,11 +227,35 @@ private:
   std::pair<const_iterator, const_iterator>
   findPrefixRange(const Name& prefix) const;
 
+  void
+  insertImpl(const Data& data, bool isUnsolicited, size_t nameHash);
+
   size_t
   eraseImpl(const Name& prefix, size_t limit);
 
+  /** \param hashes name_tree::computeHashes of the Interest name, or nullptr to compute them
+   */
+  const_iterator
+  findImpl(const Interest& interest, const name_tree::HashSequence* hashes) const;
+
+  /** \brief finds the first entry satisfying \p interest among the entries named exactly
+   *         \p interest.getName() (or its prefix without the implicit digest)
+   *  \pre !interest.getCanBePrefix()
+   */
   const_iterator
-  findImpl(const Interest& interest) const;
+  findExact(const Interest& interest, const name_tree::HashSequence* hashes) const;
+
+  /** \brief adds a new Table entry to the exact-match index and the memory usage
+   *  \param nameHash name_tree::computeHash of the Data name
+   */
+  void
+  afterInsertEntry(const_iterator it, size_t nameHash);
+
+  /** \brief removes a Table entry from the exact-match index and the memory usage,
+   *         before it's erased from the Table
+   */
+  void
+  beforeEraseEntry(const_iterator it);
 
   void
   setPolicyImpl(unique_ptr<Policy> policy);
@@ -191,11 +266,19 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
 
 private:
   Table m_table;
+
+  /** \brief exact-match index of m_table, keyed by name_tree::computeHash of the Data name
+   *
+   *  Serves Interests with CanBePrefix=false without comparing names along the ordered Table.
+   */
+  std::unordered_multimap<size_t, const_iterator> m_index;
   unique_ptr<Policy> m_policy;
   signal::ScopedConnection m_beforeEvictConnection;
 
   bool m_shouldAdmit = true; ///< if false, no Data will be admitted
   bool m_shouldServe = true; ///< if false, all lookups will miss
+  bool m_isWireOnly = false; ///< if true, only the wire encoding of new Data is stored
+  size_t m_memoryUsage = 0; ///< sum of Entry::getMemoryUsage of all entries
 };
 
 } // namespace cs
@@ -24,10 +24,13 @@
  */
 
 #include "dead-nonce-list.hpp"
+#include "name-tree-hashtable.hpp"
 #include "common/city-hash.hpp"
 #include "common/global.hpp"
 #include "common/logger.hpp"
 
+#include <cmath>
+
 namespace nfd {
 
 NFD_LOG_INIT(DeadNonceList);
@@ -42,6 +45,9 @@ const size_t DeadNonceList::EXPECTED_MARK_COUNT = 5;
 const double DeadNonceList::CAPACITY_UP = 1.2;
 const double DeadNonceList::CAPACITY_DOWN = 0.9;
 const size_t DeadNonceList::EVICT_LIMIT = 1 << 6;
+const unsigned DeadNonceList::MIN_FILTER_QUOTIENT_BITS = 4;
+const unsigned DeadNonceList::MAX_FILTER_QUOTIENT_BITS =
+  DeadNonceList::getFilterQuotientBits(MAX_CAPACITY + EVICT_LIMIT);
 
 DeadNonceList::DeadNonceList(time::nanoseconds lifetime)
   : m_lifetime(lifetime)
@@ -83,43 +89,208 @@ DeadNonceList::~DeadNonceList()
 size_t
 DeadNonceList::size() const
 {
-  return m_queue.size() - this->countMarks();
+  return this->getQueueSize() - this->countMarks();
 }
 
 bool
 DeadNonceList::has(const Name& name, uint32_t nonce) const
 {
-  Entry entry = DeadNonceList::makeEntry(name, nonce);
+  return this->has(name_tree::computeHash(name), nonce);
+}
+
+bool
+DeadNonceList::has(size_t nameHash, uint32_t nonce) const
+{
+  Entry entry = DeadNonceList::makeEntry(nameHash, nonce);
+  if (m_filter != nullptr) {
+    return m_filter->contains(this->getFingerprint(entry));
+  }
   return m_ht.find(entry) != m_ht.end();
 }
 
 void
 DeadNonceList::add(const Name& name, uint32_t nonce)
 {
-  Entry entry = DeadNonceList::makeEntry(name, nonce);
-  m_queue.push_back(entry);
+  this->add(name_tree::computeHash(name), nonce);
+}
+
+void
+DeadNonceList::add(size_t nameHash, uint32_t nonce)
+{
+  Entry entry = DeadNonceList::makeEntry(nameHash, nonce);
+  this->pushBack(entry);
 
   this->evictEntries();
 }
 
 DeadNonceList::Entry
-DeadNonceList::makeEntry(const Name& name, uint32_t nonce)
+DeadNonceList::makeEntry(size_t nameHash, uint32_t nonce)
+{
+  Entry entry = CityHash64WithSeed(reinterpret_cast<const char*>(&nameHash), sizeof(nameHash),
+                                   static_cast<uint64_t>(nonce));
+  // MARKs are counted rather than looked up when the QuotientFilter is enabled
+  return entry == MARK ? entry + 1 : entry;
+}
+
+uint64_t
+DeadNonceList::getFingerprint(Entry entry) const
+{
+  uint64_t fingerprint = entry & ((uint64_t(1) << m_filterQueue.getWidth()) - 1);
+  return fingerprint == MARK ? fingerprint + 1 : fingerprint;
+}
+
+void
+DeadNonceList::enableQuotientFilter(double falsePositiveRate)
+{
+  if (falsePositiveRate < 0.0 || falsePositiveRate >= 1.0) {
+    NDN_THROW(std::invalid_argument("falsePositiveRate must be in [0, 1)"));
+  }
+
+  if (falsePositiveRate == 0.0) {
+    if (m_filter != nullptr) {
+      // the entries cannot be restored from their fingerprints
+      NFD_LOG_DEBUG("enableQuotientFilter dropping " << m_filter->size() << " entries");
+      for (size_t i = 0; i < m_nFilterMarks; ++i) {
+        m_queue.push_back(MARK);
+      }
+      m_filter.reset();
+      m_filterQueue = PackedQueue();
+      m_nFilterMarks = 0;
+    }
+    return;
+  }
+
+  // at most size()/getNSlots() * 2^-remainderBits, and size()/getNSlots() is below 1
+  m_filterRemainderBits = static_cast<unsigned>(std::ceil(-std::log2(falsePositiveRate)));
+  m_filterRemainderBits = std::max(1U, std::min(m_filterRemainderBits,
+                                                QuotientFilter::MAX_REMAINDER_BITS));
+
+  unsigned fingerprintBits = m_filterRemainderBits + MAX_FILTER_QUOTIENT_BITS;
+  if (m_filter == nullptr) {
+    m_filterQueue = PackedQueue(fingerprintBits);
+    for (Entry entry : m_queue) {
+      m_filterQueue.push_back(entry == MARK ? MARK : this->getFingerprint(entry));
+    }
+    m_nFilterMarks = this->countMarks();
+    m_index.clear();
+  }
+  else if (fingerprintBits != m_filterQueue.getWidth()) {
+    this->resizeFingerprints(fingerprintBits);
+  }
+  this->rebuildFilter(getFilterQuotientBits(std::max(m_capacity, m_filterQueue.size())));
+
+  NFD_LOG_DEBUG("enableQuotientFilter remainderBits=" << m_filterRemainderBits
+                << " quotientBits=" << m_filter->getQuotientBits());
+}
+
+size_t
+DeadNonceList::getQueueSize() const
+{
+  return m_filter != nullptr ? m_filterQueue.size() : m_queue.size();
+}
+
+void
+DeadNonceList::pushBack(Entry entry)
+{
+  if (m_filter == nullptr) {
+    m_queue.push_back(entry);
+    return;
+  }
+
+  if (entry == MARK) {
+    m_filterQueue.push_back(MARK);
+    ++m_nFilterMarks;
+    return;
+  }
+
+  uint64_t fingerprint = this->getFingerprint(entry);
+  m_filterQueue.push_back(fingerprint);
+  if ((m_filter->size() + 1) * 4 > m_filter->getNSlots() * 3) {
+    this->rebuildFilter(m_filter->getQuotientBits() + 1);
+  }
+  else {
+    m_filter->insert(fingerprint);
+  }
+}
+
+void
+DeadNonceList::popFront()
+{
+  if (m_filter == nullptr) {
+    m_queue.erase(m_queue.begin());
+    return;
+  }
+
+  uint64_t fingerprint = m_filterQueue.front();
+  m_filterQueue.pop_front();
+  if (fingerprint == MARK) {
+    --m_nFilterMarks;
+  }
+  else {
+    m_filter->erase(fingerprint);
+  }
+}
+
+void
+DeadNonceList::rebuildFilter(unsigned quotientBits)
+{
+  BOOST_ASSERT(quotientBits + m_filterRemainderBits <= m_filterQueue.getWidth());
+  m_filter = make_unique<QuotientFilter>(quotientBits, m_filterRemainderBits);
+  for (size_t i = 0; i < m_filterQueue.size(); ++i) {
+    if (m_filterQueue[i] != MARK) {
+      m_filter->insert(m_filterQueue[i]);
+    }
+  }
+}
+
+void
+DeadNonceList::resizeFingerprints(unsigned fingerprintBits)
+{
+  bool canShorten = fingerprintBits < m_filterQueue.getWidth();
+  if (!canShorten) {
+    NFD_LOG_DEBUG("resizeFingerprints dropping " << m_filter->size() << " entries");
+  }
+
+  PackedQueue queue(fingerprintBits);
+  uint64_t mask = (uint64_t(1) << fingerprintBits) - 1;
+  for (size_t i = 0; i < m_filterQueue.size(); ++i) {
+    uint64_t fingerprint = m_filterQueue[i];
+    if (fingerprint == MARK) {
+      queue.push_back(MARK);
+    }
+    else if (canShorten) {
+      // same as getFingerprint() of the entry with the shorter width
+      fingerprint &= mask;
+      queue.push_back(fingerprint == MARK ? fingerprint + 1 : fingerprint);
+    }
+  }
+  m_filterQueue = std::move(queue);
+}
+
+unsigned
+DeadNonceList::getFilterQuotientBits(size_t nEntries)
 {
-  Block nameWire = name.wireEncode();
-  return CityHash64WithSeed(reinterpret_cast<const char*>(nameWire.wire()), nameWire.size(),
-                            static_cast<uint64_t>(nonce));
+  // keep the load factor at most 3/4
+  unsigned quotientBits = MIN_FILTER_QUOTIENT_BITS;
+  while ((size_t(1) << quotientBits) * 3 < nEntries * 4) {
+    ++quotientBits;
+  }
+  return quotientBits;
 }
 
 size_t
 DeadNonceList::countMarks() const
 {
+  if (m_filter != nullptr) {
+    return m_nFilterMarks;
+  }
   return m_ht.count(MARK);
 }
 
 void
 DeadNonceList::mark()
 {
-  m_queue.push_back(MARK);
+  this->pushBack(MARK);
   size_t nMarks = this->countMarks();
   m_actualMarkCounts.insert(nMarks);
 
@@ -146,20 +317,28 @@ DeadNonceList::adjustCapacity()
   m_actualMarkCounts.clear();
   this->evictEntries();
 
+  if (m_filter != nullptr) {
+    // shrink the QuotientFilter when it is much larger than needed
+    unsigned quotientBits = getFilterQuotientBits(std::max(m_capacity, m_filter->size()));
+    if (quotientBits + 1 < m_filter->getQuotientBits()) {
+      this->rebuildFilter(quotientBits);
+    }
+  }
+
   m_adjustCapacityEvent = getScheduler().schedule(m_adjustCapacityInterval, [this] { adjustCapacity(); });
 }
 
 void
 DeadNonceList::evictEntries()
 {
-  ssize_t nOverCapacity = m_queue.size() - m_capacity;
+  ssize_t nOverCapacity = this->getQueueSize() - m_capacity;
   if (nOverCapacity <= 0) // not over capacity
     return;
 
   for (ssize_t nEvict = std::min<ssize_t>(nOverCapacity, EVICT_LIMIT); nEvict > 0; --nEvict) {
-    m_queue.erase(m_queue.begin());
+    this->popFront();
   }
-  BOOST_ASSERT(m_queue.size() >= m_capacity);
+  BOOST_ASSERT(this->getQueueSize() >= m_capacity);
 }
 
 } // namespace nfd
@@ -27,6 +27,7 @@
 #define NFD_DAEMON_TABLE_DEAD_NONCE_LIST_HPP
 
 #include "core/common.hpp"
+#include "quotient-filter.hpp"
 
 #include <boost/multi_index_container.hpp>
 #include <boost/multi_index/hashed_index.hpp>
@@ -43,7 +44,13 @@ namespace nfd {
  *  To reduce memory usage, the Interest Name and Nonce are stored as a 64-bit hash.
  *  There could be false positives (non-looping Interest could be considered looping),
  *  but the probability is small, and the error is recoverable when consumer retransmits
- *  with a different Nonce.
+ *  with a different Nonce. The hash is derived from the name tree hash of the Name,
+ *  so that no Name encoding is needed on lookup.
+ *
+ *  On nodes where memory is scarce, enableQuotientFilter() replaces the hashtable with
+ *  a QuotientFilter that holds shorter fingerprints, at a configurable false positive rate.
+ *  An entry then takes remainderBits + 3 bits in the filter, and a fingerprint of
+ *  remainderBits + MAX_FILTER_QUOTIENT_BITS bits in the queue used for eviction.
  *
  *  To reduce memory usage, entries do not have associated timestamps. Instead,
  *  lifetime of entries is controlled by dynamically adjusting the capacity of the container.
@@ -72,11 +79,42 @@ public:
   bool
   has(const Name& name, uint32_t nonce) const;
 
+  /** \brief Determines if name+nonce exists
+   *  \param nameHash name_tree::computeHash of the Name
+   *  \return true if name+nonce exists
+   */
+  bool
+  has(size_t nameHash, uint32_t nonce) const;
+
   /** \brief Records name+nonce
    */
   void
   add(const Name& name, uint32_t nonce);
 
+  /** \brief Records name+nonce
+   *  \param nameHash name_tree::computeHash of the Name
+   */
+  void
+  add(size_t nameHash, uint32_t nonce);
+
+  /** \brief Stores entries in a QuotientFilter instead of a hashtable
+   *  \param falsePositiveRate upper bound of the probability that has() returns true
+   *         for a name+nonce that was not added; 0 switches back to the hashtable
+   *  \throw std::invalid_argument if falsePositiveRate is not in [0, 1)
+   *
+   *  Entries already recorded are kept when the hashtable is replaced, or when the filter
+   *  gets shorter fingerprints. Only fingerprints are stored in the filter, so its entries are
+   *  dropped when switching back to the hashtable, or to longer fingerprints.
+   */
+  void
+  enableQuotientFilter(double falsePositiveRate);
+
+  bool
+  isQuotientFilterEnabled() const
+  {
+    return m_filter != nullptr;
+  }
+
   /** \return number of stored Nonces
    *  \note The return value does not contain non-Nonce entries in the index, if any.
    */
@@ -95,7 +133,7 @@ private: // Entry and Index
   typedef uint64_t Entry;
 
   static Entry
-  makeEntry(const Name& name, uint32_t nonce);
+  makeEntry(size_t nameHash, uint32_t nonce);
 
   typedef boost::multi_index_container<
     Entry,
@@ -110,6 +148,46 @@ private: // Entry and Index
   typedef Index::nth_index<0>::type Queue;
   typedef Index::nth_index<1>::type Hashtable;
 
+  /** \return the fingerprint of \p entry stored in m_filterQueue, which is never MARK
+   */
+  uint64_t
+  getFingerprint(Entry entry) const;
+
+private: // storage
+  /** \brief Return the number of entries in the queue, including MARKs
+   */
+  size_t
+  getQueueSize() const;
+
+  /** \brief Append an entry or a MARK to the queue
+   */
+  void
+  pushBack(Entry entry);
+
+  /** \brief Remove the oldest entry or MARK from the queue
+   */
+  void
+  popFront();
+
+  /** \brief Replace the QuotientFilter with one of 2^quotientBits slots, holding the
+   *         entries in m_filterQueue
+   */
+  void
+  rebuildFilter(unsigned quotientBits);
+
+  /** \brief Replace m_filterQueue with one of \p fingerprintBits bits per fingerprint
+   *
+   *  Fingerprints are shortened if there are fewer bits. If there are more bits, they cannot be
+   *  restored, so only the MARKs are kept.
+   */
+  void
+  resizeFingerprints(unsigned fingerprintBits);
+
+  /** \return the number of quotient bits for a QuotientFilter of \p nEntries entries
+   */
+  static unsigned
+  getFilterQuotientBits(size_t nEntries);
+
 private: // actual lifetime estimation and capacity control
   /** \brief Return the number of MARKs in the index
    */
@@ -146,6 +224,17 @@ private:
   Queue& m_queue;
   Hashtable& m_ht;
 
+  /** \brief fingerprints of the entries in m_filterQueue, if the QuotientFilter is enabled
+   *
+   *  When enabled, m_index is empty, and the fingerprints of the entries, or MARKs, are kept in
+   *  m_filterQueue in insertion order, so that they can be evicted from the filter, and the
+   *  filter can be rebuilt with up to MAX_FILTER_QUOTIENT_BITS quotient bits.
+   */
+  unique_ptr<QuotientFilter> m_filter;
+  PackedQueue m_filterQueue;
+  size_t m_nFilterMarks = 0;
+  unsigned m_filterRemainderBits = 0;
+
 PUBLIC_WITH_TESTS_ELSE_PRIVATE: // actual lifetime estimation and capacity control
 
   // ---- current capacity and hard limits
@@ -206,6 +295,12 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE: // actual lifetime estimation and capacity contr
 
   /// Maximum number of entries to evict at each operation if index is over capacity
   static const size_t EVICT_LIMIT;
+
+  /// Minimum number of quotient bits of the QuotientFilter
+  static const unsigned MIN_FILTER_QUOTIENT_BITS;
+
+  /// Maximum number of quotient bits of the QuotientFilter, enough for MAX_CAPACITY entries
+  static const unsigned MAX_FILTER_QUOTIENT_BITS;
 };
 
 } // namespace nfd
@@ -0,0 +1,87 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "dmif-table.hpp"
+#include "common/logger.hpp"
+
+#include <ns3/simulator.h>
+
+namespace nfd {
+
+NFD_LOG_INIT(DmifTable);
+
+const int DmifTable::DMIF_DELAY = 5000;
+
+DmifTable::~DmifTable()
+{
+  m_checkEvent.Cancel();
+}
+
+uint32_t
+DmifTable::findOrInsert(const Name& name, uint32_t forwarderId, bool allowInsert,
+                        bool interest_or_data, uint32_t iOrd)
+{
+  if (!m_checkEvent.IsRunning()) {
+    this->checkExpired();
+  }
+
+  bool isAnyForwarder = (allowInsert && !interest_or_data && iOrd == 2) ||
+                        (!allowInsert && !interest_or_data && iOrd == 1);
+
+  name_tree::HashValue h = name_tree::computeHash(name);
+  Table::Record* record = m_table.find(name, h, [=] (const Value& v) {
+    return v.iOrd == iOrd && (isAnyForwarder || v.forwarderId == forwarderId);
+  });
+
+  if (record != nullptr) {
+    return record->value.forwarderId;
+  }
+
+  // records other than Interest or Data ones are inserted in any case, and never expire
+  bool isKnownKind = iOrd == 1 || iOrd == 2;
+  if (isKnownKind && !(allowInsert && interest_or_data)) {
+    return 40000;
+  }
+
+  m_table.insert(name, h, ns3::Simulator::Now(), {forwarderId, iOrd}, isKnownKind);
+  NFD_LOG_TRACE("insert " << name << " forwarder=" << forwarderId << " iOrd=" << iOrd);
+  return forwarderId;
+}
+
+void
+DmifTable::checkExpired()
+{
+  int64_t now = ns3::Simulator::Now().GetMilliSeconds();
+  size_t nExpired = m_table.expire([now] (const Table::Record& record) {
+    return now - record.timestamp.GetMilliSeconds() >= DMIF_DELAY;
+  });
+  NFD_LOG_TRACE("expired " << nExpired);
+
+  m_checkEvent.Cancel();
+  m_checkEvent = ns3::Simulator::Schedule(ns3::MilliSeconds(DMIF_DELAY + 0.01),
+                                          &DmifTable::checkExpired, this);
+}
+
+} // namespace nfd
@@ -0,0 +1,95 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_DMIF_TABLE_HPP
+#define NFD_DAEMON_TABLE_DMIF_TABLE_HPP
+
+#include "soft-state-table.hpp"
+
+#include "ns3/event-id.h"
+
+namespace nfd {
+
+/** \brief DMIF records of a forwarder
+ *
+ *  A DMIF record remembers the forwarder that handled a name, for Interests (iOrd == 1) or
+ *  Data (iOrd == 2). Records are kept for DMIF_DELAY after they are created; expired records
+ *  are checked for every DMIF_DELAY once the table is first used.
+ *
+ *  The records used to be stored as extra nodes of the NameTree hashtable. They are kept in
+ *  their own table so that lookups of regular name tree entries do not traverse them.
+ */
+class DmifTable : noncopyable
+{
+public:
+  ~DmifTable();
+
+  /** \return number of records
+   */
+  size_t
+  size() const
+  {
+    return m_table.size();
+  }
+
+  /** \brief find, or insert, the record of \p name for \p forwarderId
+   *
+   *  The record is inserted when \p allowInsert and \p interest_or_data are both true and it
+   *  does not exist. The forwarder of any record of \p name is accepted when looking up Data
+   *  with \p allowInsert and without \p interest_or_data, or Interests with neither of them.
+   *
+   *  \return forwarder id of the record, or 40000 if it does not exist and is not inserted
+   */
+  uint32_t
+  findOrInsert(const Name& name, uint32_t forwarderId, bool allowInsert, bool interest_or_data,
+               uint32_t iOrd);
+
+  /** \brief erase expired records and schedule the next check
+   */
+  void
+  checkExpired();
+
+public:
+  /** \brief lifetime of a record, in milliseconds
+   */
+  static const int DMIF_DELAY;
+
+private:
+  struct Value
+  {
+    uint32_t forwarderId;
+    uint32_t iOrd;
+  };
+
+  using Table = SoftStateTable<Value>;
+
+private:
+  Table m_table;
+  ns3::EventId m_checkEvent;
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_DMIF_TABLE_HPP
@@ -31,6 +31,8 @@
 
 #include <ndn-cxx/util/concepts.hpp>
 
+#include <algorithm>
+
 namespace nfd {
 namespace fib {
 
@@ -247,6 +249,32 @@ Fib::addOrUpdateNextHop(Entry& entry, Face& face, uint64_t cost)
     this->afterNewNextHop(entry.getPrefix(), *it);
 }
 
+void
+Fib::addOrUpdateNextHops(Entry& entry, const std::vector<std::pair<Face*, uint64_t>>& nextHops)
+{
+  std::vector<const Face*> newFaces;
+  for (const auto& faceAndCost : nextHops) {
+    auto it = entry.findNextHop(*faceAndCost.first);
+    if (it == entry.m_nextHops.end()) {
+      entry.m_nextHops.emplace_back(*faceAndCost.first);
+      it = std::prev(entry.m_nextHops.end());
+      newFaces.push_back(faceAndCost.first);
+    }
+    it->setCost(faceAndCost.second);
+  }
+  entry.sortNextHops();
+
+  if (newFaces.empty()) {
+    return;
+  }
+  for (const NextHop& nextHop : entry.getNextHops()) {
+    if (std::find(newFaces.begin(), newFaces.end(), &nextHop.getFace()) != newFaces.end()) {
+      this->afterNewNextHop(entry.getPrefix(), nextHop);
+      return;
+    }
+  }
+}
+
 Fib::RemoveNextHopResult
 Fib::removeNextHop(Entry& entry, const Face& face)
 {
@@ -165,6 +165,15 @@ public: // mutation
   void
   addOrUpdateNextHop(Entry& entry, Face& face, uint64_t cost);
 
+  /** \brief Add or update several NextHop records
+   *
+   *  This is equivalent to addOrUpdateNextHop for each (face, cost) pair in order, except that
+   *  the NextHop records of \p entry are sorted once, and afterNewNextHop is emitted at most
+   *  once, for the lowest-cost NextHop that was added. It is meant for installing routes in bulk.
+   */
+  void
+  addOrUpdateNextHops(Entry& entry, const std::vector<std::pair<Face*, uint64_t>>& nextHops);
+
   enum class RemoveNextHopResult {
     NO_SUCH_NEXTHOP, ///< the nexthop is not found
     NEXTHOP_REMOVED, ///< the nexthop is removed and the fib entry stays
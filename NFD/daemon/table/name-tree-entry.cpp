@@ -142,143 +142,5 @@ Entry::setStrategyChoiceEntry(unique_ptr<strategy_choice::Entry> strategyChoiceE
   }
 }
 
-/************ BF *************/
-
-void
-Entry::setName(const Name& prefix)
-  {
-    m_name= prefix;
-  }
-  
-
-void
-Entry::setCounter(const uint32_t counter)
-{
-
-	m_BF_Counter = counter;
-}
-uint32_t
-Entry::getCounter() const
-{
-  return m_BF_Counter;
-}
-
-void
-Entry::clearCounter()
-{
-	m_BF_Counter=0;	
-}
-
-
-void
-Entry::setBFTime(const ns3::Time time)
-{ 
-	m_BF_TimeStamp = time;
-}
-
-ns3::Time
-Entry::getBFTime() const
-{
-    return m_BF_TimeStamp;
-
-}
-
-
-void
-Entry::setInput(const uint32_t input)
-{ 
-	m_BF_Input = input;
-}
-
-uint32_t
-Entry::getInput() const
-{
-  return m_BF_Input;
-
-}
-
-void
-Entry::setOutput(const uint32_t output)
-{
- 
-	m_BF_Output = output;
-}
-
-uint32_t
-Entry::getOutput() const
-{
-  return m_BF_Output;
-}
-
-
-uint32_t
-Entry::getIoD ()const
-{
-  return m_BF_IoD;
-
-}
-
-void
-Entry::setIoD(const uint32_t IoD)
-{
- 
-	m_BF_IoD = IoD;
-}
-
-
-
-
-/************ BF *************/
-
-
-
-
-
-/************ DMIF *************/
-void
-Entry::setForwarderId(const uint32_t id){
-	m_DMIF_forwarderId = id;
-}
-uint32_t
-Entry::getForwarderId() const
-{
-	
-  return m_DMIF_forwarderId;
-	
-}
-
-void
-Entry::setInterestOrData(const uint32_t iOrd){ 
-	m_DMIF_InterestOrData = iOrd;
-}
-
-uint32_t
-Entry::getInterestOrData() const
-{
-		
-    return m_DMIF_InterestOrData;
-}
-
-
-void
-Entry::setDMIFTime(const ns3::Time time)
-{ 
-	m_DMIF_TimeStamp = time;
-}
-
-ns3::Time
-Entry::getDMIFTime() const
-{
-    return m_DMIF_TimeStamp;
-
-}
-
-
-
-
-/************ DMIF *************/
-
-
-
 } // namespace name_tree
 } // namespace nfd
@@ -52,9 +52,6 @@ public:
   }
 
 
-  void
-  setName(const Name& prefix);
- 
   /** \return entry of getName().getPrefix(-1)
    *  \retval nullptr this entry is the root entry, i.e. getName() == Name()
    */
@@ -169,44 +166,6 @@ public: // attached table entries
     return tableEntry.m_nameTreeEntry;
   }
 
-  /****** BF ********/
-public:
-	
-	uint32_t getCounter() const;
-	void setCounter(const uint32_t counter);
-	void clearCounter();
-	
-	uint32_t  getInput() const;
-	void  setInput(const uint32_t input) ;
-	
-        uint32_t  getOutput() const;
-	void  setOutput(const uint32_t IoD) ;
-	
-	uint32_t  getIoD() const;
-	void  setIoD(const uint32_t IoD) ;
-	
-        ns3::Time getBFTime() const;
-	void setBFTime (const ns3::Time time);
-	
-  /****** BF ********/
-
-
-
-
-  /****** DMIF ********/
-public:
-	
-	uint32_t getForwarderId() const;
-	void setForwarderId(const uint32_t id);
-	uint32_t  getInterestOrData() const;
-	void  setInterestOrData(const uint32_t iOrd) ;
-	
-        ns3::Time getDMIFTime() const;
-	void setDMIFTime (const ns3::Time time);
-	
-  /****** DMIF ********/
-
-
 private:
   Name m_name;
   Node* m_node;
@@ -218,24 +177,6 @@ private:
   unique_ptr<measurements::Entry> m_measurementsEntry;
   unique_ptr<strategy_choice::Entry> m_strategyChoiceEntry;
 
-  /****** BF ********/
-  uint32_t m_BF_Counter=0;
-  uint32_t  m_BF_Input=0;
-  uint32_t  m_BF_Output=0;
-  uint32_t  m_BF_IoD=0;
-  ns3::Time  m_BF_TimeStamp;
-  
-  /****** BF ********/
-
-
- /****** DMIF ********/
-  uint32_t m_DMIF_forwarderId;
-  uint32_t  m_DMIF_InterestOrData;
-  ns3::Time  m_DMIF_TimeStamp;
-  
-  /****** DMIF ********/
-
-
   friend Node* getNode(const Entry& entry);
 };
 
@@ -23,11 +23,6 @@
  * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
  */
 
- const int  DMIF_Delay=5000;
-
-const int  BF_Delay=400000;
-
- 
 #include "name-tree-hashtable.hpp"
 #include "common/city-hash.hpp"
 #include "common/logger.hpp"
@@ -78,13 +73,25 @@ public:
  */
 using HashFunc = std::conditional<(sizeof(HashValue) > 4), Hash64, Hash32>::type;
 
+static HashCounters g_hashCounters;
+
+HashCounters&
+getHashCounters()
+{
+  return g_hashCounters;
+}
+
 HashValue
 computeHash(const Name& name, size_t prefixLen)
 {
   name.wireEncode(); // ensure wire buffer exists
 
+  size_t last = std::min(prefixLen, name.size());
+  ++g_hashCounters.nNames;
+  g_hashCounters.nComponents += last;
+
   HashValue h = 0;
-  for (size_t i = 0, last = std::min(prefixLen, name.size()); i < last; ++i) {
+  for (size_t i = 0; i < last; ++i) {
     const name::Component& comp = name[i];
     h ^= HashFunc::compute(comp.wire(), comp.size());
   }
@@ -97,6 +104,9 @@ computeHashes(const Name& name, size_t prefixLen)
   name.wireEncode(); // ensure wire buffer exists
 
   size_t last = std::min(prefixLen, name.size());
+  ++g_hashCounters.nNames;
+  g_hashCounters.nComponents += last;
+
   HashSequence seq;
   seq.reserve(last + 1);
 
@@ -131,6 +141,25 @@ getNode(const Entry& entry)
   return entry.m_node;
 }
 
+std::ostream&
+operator<<(std::ostream& os, HashtableLayout layout)
+{
+  switch (layout) {
+    case HashtableLayout::CHAINED:
+      return os << "chained";
+    case HashtableLayout::OPEN_ADDRESSING:
+      return os << "open-addressing";
+  }
+  return os << static_cast<int>(layout);
+}
+
+const uint32_t Hashtable::NO_NODE;
+const uint32_t Hashtable::CHUNK_SIZE;
+
+/** \brief highest load factor of the OPEN_ADDRESSING layout
+ */
+static const float MAX_OPEN_LOAD_FACTOR = 0.9f;
+
 HashtableOptions::HashtableOptions(size_t size)
   : initialSize(size)
   , minSize(size)
@@ -151,12 +180,24 @@ Hashtable::Hashtable(const Options& options)
   BOOST_ASSERT(m_options.shrinkFactor > 0.0);
   BOOST_ASSERT(m_options.shrinkFactor < 1.0);
 
-  m_buckets.resize(options.initialSize);
+  if (m_options.layout == HashtableLayout::CHAINED) {
+    m_buckets.resize(options.initialSize);
+  }
+  else {
+    BOOST_ASSERT(options.initialSize < NO_NODE);
+    m_slots.assign(options.initialSize, Slot{0, NO_NODE});
+  }
   this->computeThresholds();
 }
 
 Hashtable::~Hashtable()
 {
+  for (const Slot& slot : m_slots) {
+    if (slot.index != NO_NODE) {
+      this->getChunkNode(slot.index)->~Node();
+    }
+  }
+
   for (size_t i = 0; i < m_buckets.size(); ++i) {
     foreachNode(m_buckets[i], [] (Node* node) {
       node->prev = node->next = nullptr;
@@ -205,145 +246,60 @@ Hashtable::detach(size_t bucket, Node* node)
 
 
 
-void
-Hashtable::DMIF_PeriodicCheck_Fib_Entries()
+const Node*
+Hashtable::getFirstNode() const
 {
+  if (m_options.layout == HashtableLayout::OPEN_ADDRESSING) {
+    for (const Slot& slot : m_slots) {
+      if (slot.index != NO_NODE) {
+        return this->getChunkNode(slot.index);
+      }
+    }
+    return nullptr;
+  }
 
-   
- 
- for (size_t i = 0; i < m_buckets.size(); ++i) 
- {
-    foreachNode(m_buckets[i], [this] (Node* node) 
-    
-    {
-        size_t bucket = this->computeBucketIndex(node->hash);
-       
-       auto iOrd = node->entry.getInterestOrData();
-       auto TimeStamp= node->entry.getDMIFTime();
-       
-       ns3::Time now = ns3::Simulator::Now ();
-       auto interval=(now.GetMilliSeconds()-TimeStamp.GetMilliSeconds());
-    
-       
-       if(interval>=DMIF_Delay && iOrd==1) 
-       {
-        
-   
-        this->detach(bucket, node); delete node;
-         --m_size;
-         
-          if (m_size < m_shrinkThreshold) 
-            {       
-              size_t newNBuckets = std::max(m_options.minSize,
-              static_cast<size_t>(m_options.shrinkFactor * this->getNBuckets()));
-              this->resize(newNBuckets);
-           }  
-         
-       }
-       
-    if(interval>=DMIF_Delay && iOrd==2) 
-       {
-          
-             this->detach(bucket,node); delete node;
-            --m_size;
-          
-          
-          if (m_size < m_shrinkThreshold) 
-            {  
-              size_t newNBuckets = std::max(m_options.minSize,
-              static_cast<size_t>(m_options.shrinkFactor * this->getNBuckets()));
-              this->resize(newNBuckets);
-            } 
-        
-        
-        
-       }
-     } );
-}
-
-     ns3::Simulator::Schedule(ns3::MilliSeconds(DMIF_Delay+0.01), &Hashtable::DMIF_PeriodicCheck_Fib_Entries, this);
+  for (const Node* head : m_buckets) {
+    if (head != nullptr) {
+      return head;
+    }
+  }
+  return nullptr;
 }
 
-
-
-
-void
-Hashtable::BF_Periodic_check_fib_entries() 
+const Node*
+Hashtable::getNextNode(const Node* node) const
 {
+  if (m_options.layout == HashtableLayout::OPEN_ADDRESSING) {
+    for (size_t i = this->findSlot(node) + 1; i < m_slots.size(); ++i) {
+      if (m_slots[i].index != NO_NODE) {
+        return this->getChunkNode(m_slots[i].index);
+      }
+    }
+    return nullptr;
+  }
 
- for (size_t i = 0; i < m_buckets.size(); ++i) 
- {
-    
-  
-    
-    
-    foreachNode(m_buckets[i], [this] (Node* node) 
-    
-    {
-        size_t bucket = this->computeBucketIndex(node->hash);
-       
-  //     auto input = node->entry.getInput();
-  //     auto output = node->entry.getOutput();
-       
-   //    uint32_t counter=node->entry.getCounter(); 
-       
-       uint32_t IoD=node->entry.getIoD(); 
-       
-       
-       auto TimeStamp= node->entry.getBFTime();
-       
-       ns3::Time now = ns3::Simulator::Now ();
-       auto interval=(now.GetMilliSeconds()-TimeStamp.GetMilliSeconds());
-    
-    
-       
-       if(interval>BF_Delay && IoD==1) 
-       {
-        this->detach(bucket, node); delete node;
-         --m_size;
-         
-           if (m_size < m_shrinkThreshold) 
-            {  
-              size_t newNBuckets = std::max(m_options.minSize,
-              static_cast<size_t>(m_options.shrinkFactor * this->getNBuckets()));
-              this->resize(newNBuckets);
-            } 
-     
-     }
-     
-     
-      if(interval>BF_Delay && IoD==2) 
-       {
-        this->detach(bucket, node); delete node;
-         --m_size;
-         
-           if (m_size < m_shrinkThreshold) 
-            {  
-              size_t newNBuckets = std::max(m_options.minSize,
-              static_cast<size_t>(m_options.shrinkFactor * this->getNBuckets()));
-              this->resize(newNBuckets);
-            } 
-     
-     }
-     
-     
-       
-     } );
+  if (node->next != nullptr) {
+    return node->next;
   }
-     ns3::Simulator::Schedule(ns3::MilliSeconds(BF_Delay+0.01), &Hashtable::BF_Periodic_check_fib_entries, this);
-     
+  for (size_t bucket = this->computeBucketIndex(node->hash) + 1; bucket < m_buckets.size(); ++bucket) {
+    if (m_buckets[bucket] != nullptr) {
+      return m_buckets[bucket];
+    }
+  }
+  return nullptr;
 }
 
-
-
 std::pair<const Node*, bool>
 Hashtable::findOrInsert(const Name& name, size_t prefixLen, HashValue h, bool allowInsert)
 {
+  if (m_options.layout == HashtableLayout::OPEN_ADDRESSING) {
+    return this->findOrInsertOpen(name, prefixLen, h, allowInsert);
+  }
+
   size_t bucket = this->computeBucketIndex(h);
 
   for (const Node* node = m_buckets[bucket]; node != nullptr; node = node->next) {
-    if (node->hash == h && name.compare(0, prefixLen, node->entry.getName()) == 0 && (node->entry.getInterestOrData()==0)&& (node->entry.getCounter()==0)&& (node->entry.getInput()==0) && (node->entry.getOutput()==0))  
-    {
+    if (node->hash == h && name.compare(0, prefixLen, node->entry.getName()) == 0) {
       NFD_LOG_TRACE("found " << name.getPrefix(prefixLen) << " hash=" << h << " bucket=" << bucket);
       return {node, false};
     }
@@ -355,14 +311,6 @@ Hashtable::findOrInsert(const Name& name, size_t prefixLen, HashValue h, bool al
   }
 
   Node* node = new Node(h, name.getPrefix(prefixLen));
-  
-  node->entry.setForwarderId(0);
-
-  node->entry.setInterestOrData(0);
-  node->entry.setCounter(0);
-  node->entry.setInput(0);
-  node->entry.setOutput(0);
-   
   this->attach(bucket, node);
   NFD_LOG_TRACE("insert " << node->entry.getName() << " hash=" << h << " bucket=" << bucket);
   ++m_size;
@@ -375,664 +323,6 @@ Hashtable::findOrInsert(const Name& name, size_t prefixLen, HashValue h, bool al
 }
 
 
-/********* BF **********/
-void
-Hashtable::Entry_insert_name(const Name& name, uint32_t x, uint32_t IoD)
-{
-
-        
-       if(m_BF_bool1==0) 
-        {
-         m_BF_bool1=1;
- //          this->BF_Periodic_check_fib_entries();
-        }
-        
-        auto prefixLen=name.size();
-        HashValue h = computeHash(name, prefixLen);  
-                 
-        size_t bucket = this->computeBucketIndex(h);
-
-        int bool1=0;
-		
-	for (Node* node = m_buckets[bucket]; node != nullptr; node = node->next) 
-	 {
-				 
-	   Name  name1=node->entry.getName();
-	   uint32_t input = node->entry.getInput();	
-//	   uint32_t output = node->entry.getOutput();
-	   
-	   uint32_t counter=node->entry.getCounter();
-           uint32_t IoD1=node->entry.getIoD();
-
-           if (node->hash == h  && name.compare(name1)==0 && input==x && IoD1==IoD && counter!=0 )
-           {
-	      bool1=1;
-	      auto counter1=node->entry.getCounter();
-              counter1=counter1+1;
-              node->entry.setCounter(counter1);
-	      return;
-	   }		     
-    	
-    	}	  
-		  
-
-        
-      if(bool1==0)
-       {
-          Node* node = new Node(h, name.getPrefix(prefixLen));
-      
-       	 this->attach(bucket, node);
-
-      
-          node->entry.setName(name);
-          node->entry.setCounter(1);
-          node->entry.setInput(x);
-          node->entry.setOutput(0);
-          node->entry.setIoD(IoD);
-
-          ns3::Time now = ns3::Simulator::Now ();
-          node->entry.setBFTime(now);
-          
-    
-
-	++m_size;
-	
-	 if (m_size > m_expandThreshold) 
-	  {
-		this->resize(static_cast<size_t>(m_options.expandFactor * this->getNBuckets()));
-	  }
-
-      }
-      else
-         std::cout<< "Hashtable::Entry_insert_name WRONG CASE"<< std::endl;
-     
-   
-}
-
-
-void
-Hashtable::Entry_insert_name2(const Name& name,  uint32_t x, uint32_t y, uint32_t IoD)
-{
-
-        
-       if(m_BF_bool1==0) 
-        {
-          m_BF_bool1=1;
-           this->BF_Periodic_check_fib_entries();
-      }
-        
-        auto prefixLen=name.size();
-        HashValue h = computeHash(name, prefixLen);  
-                 
-        size_t bucket = this->computeBucketIndex(h);
-
-        int bool2=0;
-		
-	for (Node* node = m_buckets[bucket]; node != nullptr; node = node->next) 
-	 {
-				 
-	   Name  name1=node->entry.getName();
-	   uint32_t input = node->entry.getInput();	
-	   uint32_t output = node->entry.getOutput();
-	   
-	   uint32_t counter=node->entry.getCounter();
-           uint32_t IoD1=node->entry.getIoD();
-
-           if (node->hash == h  && name.compare(name1)==0 && input==x && output==y && IoD1==IoD && counter!=0 )
-           {
-	      bool2=1;
-	      auto counter1=node->entry.getCounter();
-              counter1=counter1+1;
-              node->entry.setCounter(counter1);
-	      return;
-	   }		     
-    	
-    	}	  
-		  
-
-        
-      if(bool2==0)
-       {
-          Node* node = new Node(h, name.getPrefix(prefixLen));
-      
-       	 this->attach(bucket, node);
-
-      
-          node->entry.setName(name);
-          node->entry.setCounter(1);
-          node->entry.setInput(x);
-          node->entry.setOutput(y);
-          node->entry.setIoD(IoD);
-
-          ns3::Time now = ns3::Simulator::Now ();
-          node->entry.setBFTime(now);
-          
-    
-
-	++m_size;
-	
-	 if (m_size > m_expandThreshold) 
-	  {
-		this->resize(static_cast<size_t>(m_options.expandFactor * this->getNBuckets()));
-	  }
-
-      }
-      else
-         std::cout<< "Hashtable::Entry_insert_name2 WRONG CASE"<< std::endl;
-     
-   
-}
-
-
-
-uint32_t
-Hashtable::Entry_check_name1(const Name& name, const uint32_t x, uint32_t IoD)
-{
-
-  
-    auto prefixLen=name.size();
-    HashValue h = computeHash(name, prefixLen);  
-                 
-   size_t bucket = this->computeBucketIndex(h);
-
-
-
-   int bool2=0;
-		
-   for (const Node* node = m_buckets[bucket]; node != nullptr; node = node->next) 
-    {
-			 
-      Name  name1=node->entry.getName();
-      uint32_t input = node->entry.getInput();	
-      
-    
-  //  uint32_t output = node->entry.getOutput();
-      uint32_t counter=node->entry.getCounter();
-      uint32_t IoD1=node->entry.getIoD(); 
-
-    
- 
-     if (node->hash == h && name.compare(name1)==0 && input==257 && IoD1==IoD && counter!=0)
-      {
-         bool2=1;
-         return(counter);   
-         
-      }		     
-    	
-  }	  
-		     
-  if(bool2==0)
-   {      	 
-     uint32_t counter=0;
-     std::cout<< "Hashtable::Entry_check_name1 counter= "<< counter<< std::endl;
-     return(counter);    
-   }
-   
-}
-
-
-uint32_t
-Hashtable::Entry_check_name2(const Name& name,  uint32_t x,  uint32_t y, uint32_t IoD)
-{
-
-  
-    auto prefixLen=name.size();
-    HashValue h = computeHash(name, prefixLen);  
-                 
-   size_t bucket = this->computeBucketIndex(h);
-
-
-
-   int bool2=0;
-		
-   for (const Node* node = m_buckets[bucket]; node != nullptr; node = node->next) 
-    {
-			 
-      Name  name1=node->entry.getName();
-      uint32_t input = node->entry.getInput();	
-      uint32_t output = node->entry.getOutput();
-      uint32_t counter=node->entry.getCounter();
-      uint32_t IoD1=node->entry.getIoD();  
- 
-     if (node->hash == h && name.compare(name1)==0 && input==x && output==y && IoD1==IoD && counter!=0)
-      {
-         bool2=1;
-         return(counter);   
-         
-      }		     
-    	
-  }	  
-		     
-  if(bool2==0)
-   {      	 
-     uint32_t counter=0;
-//    std::cout<< "Hashtable::Entry_check_name2 counter= "<< counter<< std::endl;
-     return(counter);    
-   }
-   
-}
-
-
-
-uint32_t
-Hashtable::Entry_check_input1(const Name& name, uint32_t IoD)
-{
- 
-    auto prefixLen=name.size();
-    HashValue h = computeHash(name, prefixLen);  
-                 
-   size_t bucket = this->computeBucketIndex(h);
-
-
-   int bool2=0;
-		
-   for (const Node* node = m_buckets[bucket]; node != nullptr; node = node->next) 
-    {
-			 
-      Name  name1=node->entry.getName();
-      uint32_t input = node->entry.getInput();	
-      uint32_t counter=node->entry.getCounter();   
-      uint32_t IoD1=node->entry.getIoD();   
- 
- 
-     if (node->hash == h  && name.compare(name1)==0 && input!=0 && IoD1==IoD && counter!=0)
-      {
-         bool2=1;
-         return(input);   
-         
-      }		     
-    	
-  }	  
-		     
-  if(bool2==0)
-   {      	 
-     std::cout<< "Hashtable::Entry_check_input1 WRONG CASE"<< std::endl;
-     return(10000);    
-   }
-   
-}
-
-uint32_t
-Hashtable::Entry_check_input2(const Name& name,  uint32_t x, uint32_t y, uint32_t IoD)
-{
- 
-    auto prefixLen=name.size();
-    HashValue h = computeHash(name, prefixLen);  
-                 
-   size_t bucket = this->computeBucketIndex(h);
-
-
-   int bool2=0;
-		
-   for (const Node* node = m_buckets[bucket]; node != nullptr; node = node->next) 
-    {
-			 
-      Name  name1=node->entry.getName();
-      uint32_t input = node->entry.getInput();	
-      uint32_t output = node->entry.getOutput();	
-      uint32_t counter=node->entry.getCounter();  
-      uint32_t IoD1=node->entry.getIoD();  
-      
-      
-     if (node->hash == h  && name.compare(name1)==0 && input==x && output==y && IoD1==IoD && counter!=0)
-      {
-         bool2=1;
-         return(input);   
-         
-      }		     
-    	
-  }	  
-		     
-  if(bool2==0)
-   {      	 
- //    std::cout<< "Hashtable::Entry_check_input2 WRONG CASE"<< std::endl;
-     return(10000);    
-   }
-   
-}
-
-uint32_t
-Hashtable::Entry_check_output2(const Name& name,  uint32_t x, uint32_t y, uint32_t IoD)
-{
-
-    auto prefixLen=name.size();
-    HashValue h = computeHash(name, prefixLen);  
-                 
-   size_t bucket = this->computeBucketIndex(h);
-
-
-   int bool2=0;
-		
-   for (const Node* node = m_buckets[bucket]; node != nullptr; node = node->next) 
-    {
-			 
-      Name  name1=node->entry.getName();
-      uint32_t input = node->entry.getInput();	
-      uint32_t output = node->entry.getOutput();	
-      uint32_t counter=node->entry.getCounter();  
-      uint32_t IoD1=node->entry.getIoD();  
-
-      
-     if (node->hash == h  && name.compare(name1)==0 && input==x && output==y && IoD1==IoD && counter!=0)
-      {
-         bool2=1;
-         return(output);   
-         
-      }		     
-    	
-  }	  
-		     
-  if(bool2==0)
-   {      	 
-  //   std::cout<< "Hashtable::Entry_check_output2 WRONG CASE"<< std::endl;
-     return(10000);    
-   }
-   
-}
-
-
-
-
-
-
-
-void
-Hashtable::Entry_clear_name(const Name& name, uint32_t x, uint32_t y, uint32_t IoD)
-{
-
-  
-    auto prefixLen=name.size();
-    HashValue h = computeHash(name, prefixLen);  
-                 
-   size_t bucket = this->computeBucketIndex(h);
-
-   int bool2=0;
-		
-   for (Node* node = m_buckets[bucket]; node != nullptr; node = node->next) 
-    {
-			 
-      Name  name1=node->entry.getName();
-      uint32_t input = node->entry.getInput();
-      uint32_t output = node->entry.getOutput();	
-      uint32_t counter=node->entry.getCounter(); 
-      uint32_t IoD1=node->entry.getIoD();  
-     
-     
-     if (node->hash == h  && name.compare(name1)==0 && input==x && output==y && IoD1==IoD && counter!=0)
-      {
-         bool2=1;
-         this->detach(bucket, node); delete node;
-         --m_size;
-         
-          if (m_size < m_shrinkThreshold) 
-          {
-             size_t newNBuckets = std::max(m_options.minSize,
-             static_cast<size_t>(m_options.shrinkFactor * this->getNBuckets()));
-              this->resize(newNBuckets);
-          }
-        return;
-      }		     
-    	
-  }	  
-		     
-  if(bool2==0)  std::cout<< "Hashtable::Entry_clear_name WRONG CASE"<< std::endl;
-  
-
-   
-}
-
-void
-Hashtable::Entry_clear_name1(const Name& name, uint32_t x, uint32_t IoD)
-{
-
-  
-    auto prefixLen=name.size();
-    HashValue h = computeHash(name, prefixLen);  
-                 
-   size_t bucket = this->computeBucketIndex(h);
-
-   int bool2=0;
-		
-   for (Node* node = m_buckets[bucket]; node != nullptr; node = node->next) 
-    {
-			 
-      Name  name1=node->entry.getName();
-      uint32_t input = node->entry.getInput();
-      uint32_t counter=node->entry.getCounter(); 
-      uint32_t IoD1=node->entry.getIoD();  
-     
-     
-     if (node->hash == h  && name.compare(name1)==0 && input==x && IoD1==IoD && counter==1)
-      {
-         bool2=1;
-         this->detach(bucket, node); delete node;
-         --m_size;
-         
-          if (m_size < m_shrinkThreshold) 
-          {
-             size_t newNBuckets = std::max(m_options.minSize,
-             static_cast<size_t>(m_options.shrinkFactor * this->getNBuckets()));
-              this->resize(newNBuckets);
-          }
-        return;
-      }		     
-    	
-  }	  
-		     
-  if(bool2==0)  std::cout<< "Hashtable::Entry_clear_name WRONG CASE"<< std::endl;
-  
-
-   
-}
-
-void
-Hashtable::Entry_lock(const Name& name, uint32_t x, uint32_t y, uint32_t IoD)
-{
-
-  
-    auto prefixLen=name.size();
-    HashValue h = computeHash(name, prefixLen);  
-                 
-   size_t bucket = this->computeBucketIndex(h);
-
-   int bool2=0;
-		
-   for (Node* node = m_buckets[bucket]; node != nullptr; node = node->next) 
-    {
-			 
-      Name  name1=node->entry.getName();
-      uint32_t input = node->entry.getInput();
-      uint32_t output = node->entry.getOutput();	
-      uint32_t counter=node->entry.getCounter(); 
-      uint32_t IoD1=node->entry.getIoD();  
- 
- 
-     if (node->hash == h  && name.compare(name1)==0 && input==x && output==y && IoD1==IoD && counter!=0)
-      {
-        bool2=1;
-        node->entry.setOutput(y);	  
-      }		     
-    	
-  }	  
-		     
-  if(bool2==0)  std::cout<< "Hashtable::Entry_lock WRONG CASE"<< std::endl;
-  
-
-   
-}
-
-
-/********* BF **********/
-
-
-
-
-
-/********* DMIF **********/
- uint32_t
-Hashtable::findOrInsert_dmif(const Name& name, size_t prefixLen, uint32_t forwarderId, bool allowInsert, bool interest_or_data, uint32_t iOrd)
-{
-               
-        
-       if(m_DMIF_bool1==0) 
-         {
-           m_DMIF_bool1=1;
-           this->DMIF_PeriodicCheck_Fib_Entries();
-         }
-   
-       
-      
-       auto prefixLen1=name.size();
-       HashValue h = computeHash(name, prefixLen1);  
-                 
-     size_t bucket = this->computeBucketIndex(h);
-       
-   //    std::cout<<"name=  "<< name<<std::endl; 
-    //   std::cout<<"fi=  "<< forwarderId<<std::endl;
-    //   std::cout<<"Ord=  "<< iOrd<<std::endl;
-    //   std::cout<<"h=  "<< h<<std::endl;     
-                 
-  
-
-
-     for (Node* node = m_buckets[bucket]; node != nullptr; node = node->next) 
-         {
-			
-        
-        
-        	   
-                    auto  name1=node->entry.getName();
-		    auto fi1 = node->entry.getForwarderId();
-		    auto iOrd1 = node->entry.getInterestOrData();
-		    auto h1=node->hash;
-		    
-			 
-          //     std::cout<<"name1=  "<< name1<<std::endl; 
-          //     std::cout<<"fi1=  "<< fi1<<std::endl;
-          //     std::cout<<"Ord1=  "<< iOrd1<<std::endl;
-         //      std::cout<<"h1=  "<< h1<<std::endl;
-                
-             if(allowInsert && interest_or_data && iOrd==2) 
-		     {      
-		          if (h1==h && name.compare(name1)==0 && forwarderId==fi1  && iOrd1==2) { std::cout<<"true true  222222222222222222222222"<< std::endl; 
-                              return (fi1);}  
-                         }
-			 	
-	    if(allowInsert && !interest_or_data && iOrd==2)  
-		       {
-		          if (h1==h && name.compare(name1)==0 && iOrd1==2)  return (fi1);    	      
-		       }
-		 		 
-		 
-	    if(!allowInsert && interest_or_data && iOrd==2) //search for data forwarder
-                         {
-                             
-                              if (h1==h && name.compare(name1)==0 && forwarderId==fi1   && iOrd1==2)  { //std::cout<<"here inside  "<< std::endl; 
-                              return (fi1);}    	 
-                         } 
-
-
-	     if(!allowInsert && !interest_or_data && iOrd==2) //search for data forwarder
-                         {
-                              if (h1==h && name.compare(name1)==0 && forwarderId==fi1 && iOrd1==2)   { //std::cout<<"false false  ord-222222222222222222222222"<< std::endl; 
-                              return (fi1);}  
-                         }
-                         
-	
-	
-	
-	     if(allowInsert && interest_or_data && iOrd==1) //search for data forwarder
-                         {
-                              
-                           //       std::cout<<"name1=  "<< name1<<std::endl; 
-                           //       std::cout<<"fi1=  "<< fi1<<std::endl;
-                           //       std::cout<<"Ord1=  "<< iOrd1<<std::endl;
-                           //        std::cout<<"h1=  "<< h1<<"    h="<<h<< std::endl;
-                              
-                               if (h1==h && name.compare(name1)==0 && forwarderId==fi1  && iOrd1==1)   { //std::cout<<"True True  1111111111111111111111111111111111  "<< std::endl; 
-                              return (fi1);}   	 
-                         }
-                         
-
-	   if(allowInsert && !interest_or_data && iOrd==1) //search for data forwarder
-                         {
-                              if (h1==h && name.compare(name1)==0 && forwarderId==fi1   && iOrd1==1)    return (fi1);    	 
-                         }	
-                         	
-	   
-	   if(!allowInsert && interest_or_data && iOrd==1) //search for data forwarder
-                         {
-                              if (h1==h && name.compare(name1)==0 && forwarderId==fi1 && iOrd1==1)    { //std::cout<<"false true 1111111111111111111111111111 "<< std::endl; 
-                              return (fi1);}  
-                         }
-		   
-	   if(!allowInsert && !interest_or_data && iOrd==1) //search for data forwarder
-                         {
-                                  
-                              if (h1==h && name.compare(name1)==0  && iOrd1==1)   { //std::cout<<"false false 11111111111111111111111111111111111111111111111 "<< std::endl; 
-                              return (fi1);}  	 
-                         }
-                         		 		
-   }
-      
- 
-  
-  if (allowInsert && !interest_or_data && iOrd==2)  return (40000);  
- 
-  if (!allowInsert && interest_or_data && iOrd==2)  return (40000);  
-
-  if (!allowInsert && !interest_or_data && iOrd==2)  return (40000);   
-  
-  
-  if (allowInsert && !interest_or_data && iOrd==1)  return (40000); 
-  
-  if(!allowInsert && interest_or_data && iOrd==1)  return (40000);
-  
-  if (!allowInsert && !interest_or_data && iOrd==1)  return (40000);
-        
-    
-    
-    
-       Node* node = new Node(h, name.getPrefix(prefixLen));    
-	
-	this->attach(bucket, node);
-
-    
-  
-         node->entry.setName(name);
-         node->entry.setForwarderId(forwarderId);
-         
-         ns3::Time now = ns3::Simulator::Now ();
-         
-         node->entry.setDMIFTime(now);
-        	
-        
-        node->entry.setInterestOrData(iOrd); 
-        
-          
-
-	++m_size;
-	
-	
-	if (m_size > m_expandThreshold) 
-	{
-	
-		this->resize(static_cast<size_t>(m_options.expandFactor * this->getNBuckets()));
-	}
-
-         
-	return {forwarderId};
- 
-
-}
-/********* DMIF **********/
-
-
-
-
-
-
-
 const Node*
 Hashtable::find(const Name& name, size_t prefixLen) const
 {
@@ -1059,42 +349,17 @@ Hashtable::insert(const Name& name, size_t prefixLen, const HashSequence& hashes
  
 
 
-/********* DMIF **********/
- uint32_t
-Hashtable::find_dmif(const Name& name, size_t prefixLen, uint32_t forwarderId, bool allowInsert, bool interest_or_data, uint32_t iOrd )  
-   {
-	
-		HashValue h = computeHash(name, prefixLen);
-		uint32_t fi= this->findOrInsert_dmif(name, prefixLen, forwarderId, allowInsert, interest_or_data, iOrd);
-		return (fi);
-		
-	
-  }
-/********* DMIF **********/
-
-
-
- uint32_t
-Hashtable::insert_dmif(const Name& name, size_t prefixLen,  uint32_t forwarderId, bool allowInsert, bool interest_or_data, uint32_t iOrd)
-{
-
-// BOOST_ASSERT(hashes.at(prefixLen) == computeHash(name, prefixLen));
-   HashValue h = computeHash(name, prefixLen);
-  
-  uint32_t fi=this->findOrInsert_dmif(name, prefixLen, forwarderId, allowInsert, interest_or_data, iOrd);
-  return(fi);
- 
-}  
-  
-
-
-
 void
 Hashtable::erase(Node* node)
 {
   BOOST_ASSERT(node != nullptr);
   BOOST_ASSERT(node->entry.getParent() == nullptr);
 
+  if (m_options.layout == HashtableLayout::OPEN_ADDRESSING) {
+    this->eraseOpen(node);
+    return;
+  }
+
   size_t bucket = this->computeBucketIndex(node->hash);
   NFD_LOG_TRACE("erase " << node->entry.getName() << " hash=" << node->hash << " bucket=" << bucket);
 
@@ -1112,7 +377,11 @@ Hashtable::erase(Node* node)
 void
 Hashtable::computeThresholds()
 {
-  m_expandThreshold = static_cast<size_t>(m_options.expandLoadFactor * this->getNBuckets());
+  float expandLoadFactor = m_options.expandLoadFactor;
+  if (m_options.layout == HashtableLayout::OPEN_ADDRESSING) {
+    expandLoadFactor = std::min(expandLoadFactor, MAX_OPEN_LOAD_FACTOR);
+  }
+  m_expandThreshold = static_cast<size_t>(expandLoadFactor * this->getNBuckets());
   m_shrinkThreshold = static_cast<size_t>(m_options.shrinkLoadFactor * this->getNBuckets());
   NFD_LOG_TRACE("thresholds expand=" << m_expandThreshold << " shrink=" << m_shrinkThreshold);
 }
@@ -1125,6 +394,12 @@ Hashtable::resize(size_t newNBuckets)
   }
   NFD_LOG_DEBUG("resize from=" << this->getNBuckets() << " to=" << newNBuckets);
 
+  if (m_options.layout == HashtableLayout::OPEN_ADDRESSING) {
+    this->resizeOpen(newNBuckets);
+    this->computeThresholds();
+    return;
+  }
+
   std::vector<Node*> oldBuckets;
   oldBuckets.swap(m_buckets);
   m_buckets.resize(newNBuckets);
@@ -1139,12 +414,118 @@ Hashtable::resize(size_t newNBuckets)
   this->computeThresholds();
 }
 
+size_t
+Hashtable::findSlot(const Node* node) const
+{
+  for (size_t i = this->computeBucketIndex(node->hash); ; i = this->nextSlot(i)) {
+    BOOST_ASSERT(m_slots[i].index != NO_NODE);
+    if (m_slots[i].index != NO_NODE && this->getChunkNode(m_slots[i].index) == node) {
+      return i;
+    }
+  }
+}
+
+std::pair<const Node*, bool>
+Hashtable::findOrInsertOpen(const Name& name, size_t prefixLen, HashValue h, bool allowInsert)
+{
+  uint32_t tag = computeSlotTag(h);
+  size_t slot = this->computeBucketIndex(h);
+
+  // there is always an empty slot, because the load factor is below 1
+  for (; m_slots[slot].index != NO_NODE; slot = this->nextSlot(slot)) {
+    if (m_slots[slot].tag != tag) {
+      continue;
+    }
+    const Node* node = this->getChunkNode(m_slots[slot].index);
+    if (node->hash == h && name.compare(0, prefixLen, node->entry.getName()) == 0) {
+      NFD_LOG_TRACE("found " << name.getPrefix(prefixLen) << " hash=" << h << " slot=" << slot);
+      return {node, false};
+    }
+  }
+
+  if (!allowInsert) {
+    NFD_LOG_TRACE("not-found " << name.getPrefix(prefixLen) << " hash=" << h << " slot=" << slot);
+    return {nullptr, false};
+  }
+
+  uint32_t index = 0;
+  if (!m_freeIndices.empty()) {
+    index = m_freeIndices.back();
+    m_freeIndices.pop_back();
+  }
+  else {
+    BOOST_ASSERT(m_nIndices < NO_NODE);
+    index = m_nIndices++;
+    if (index / CHUNK_SIZE == m_chunks.size()) {
+      m_chunks.emplace_back(new NodeStorage[CHUNK_SIZE]);
+    }
+  }
+
+  Node* node = new (this->getChunkNode(index)) Node(h, name.getPrefix(prefixLen));
+  m_slots[slot] = {tag, index};
+  NFD_LOG_TRACE("insert " << node->entry.getName() << " hash=" << h << " slot=" << slot);
+  ++m_size;
+
+  if (m_size > m_expandThreshold) {
+    this->resize(std::max(static_cast<size_t>(m_options.expandFactor * this->getNBuckets()),
+                          this->getNBuckets() + 1));
+  }
+
+  return {node, true};
+}
+
+void
+Hashtable::eraseOpen(Node* node)
+{
+  size_t slot = this->findSlot(node);
+  NFD_LOG_TRACE("erase " << node->entry.getName() << " hash=" << node->hash << " slot=" << slot);
 
+  m_freeIndices.push_back(m_slots[slot].index);
+  node->~Node();
+  --m_size;
 
+  // backward shift deletion: move later nodes of the probe sequence into the hole, so that
+  // no lookup stops early at an empty slot
+  size_t nSlots = m_slots.size();
+  size_t hole = slot;
+  for (size_t i = this->nextSlot(hole); m_slots[i].index != NO_NODE; i = this->nextSlot(i)) {
+    size_t home = m_slots[i].tag % nSlots;
+    size_t distanceFromHome = (i + nSlots - home) % nSlots;
+    size_t distanceFromHole = (i + nSlots - hole) % nSlots;
+    if (distanceFromHome >= distanceFromHole) {
+      m_slots[hole] = m_slots[i];
+      hole = i;
+    }
+  }
+  m_slots[hole].index = NO_NODE;
 
+  if (m_size < m_shrinkThreshold) {
+    size_t newNBuckets = std::max(m_options.minSize,
+      static_cast<size_t>(m_options.shrinkFactor * this->getNBuckets()));
+    this->resize(newNBuckets);
+  }
+}
 
+void
+Hashtable::resizeOpen(size_t newNSlots)
+{
+  BOOST_ASSERT(newNSlots > m_size);
+  BOOST_ASSERT(newNSlots < NO_NODE);
 
+  std::vector<Slot> oldSlots(newNSlots, Slot{0, NO_NODE});
+  oldSlots.swap(m_slots);
 
+  for (const Slot& slot : oldSlots) {
+    if (slot.index == NO_NODE) {
+      continue;
+    }
+    size_t i = slot.tag % newNSlots;
+    while (m_slots[i].index != NO_NODE) {
+      i = this->nextSlot(i);
+    }
+    m_slots[i] = slot;
+  }
+}
 
 } // namespace name_tree
 } // namespace nfd
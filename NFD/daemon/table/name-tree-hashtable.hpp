@@ -54,6 +54,24 @@ computeHash(const Name& name, size_t prefixLen = std::numeric_limits<size_t>::ma
 HashSequence
 computeHashes(const Name& name, size_t prefixLen = std::numeric_limits<size_t>::max());
 
+/** \brief counts of hash computations, for instrumentation
+ *
+ *  Forwarder computes the hash sequence of a packet name once, and passes it to the tables.
+ *  nNames divided by the number of incoming packets gives the name hashings per packet.
+ */
+struct HashCounters
+{
+  /// number of computeHash and computeHashes calls
+  uint64_t nNames = 0;
+  /// number of name components hashed by these calls
+  uint64_t nComponents = 0;
+};
+
+/** \return the counts of hash computations since the start of the program
+ */
+HashCounters&
+getHashCounters();
+
 /** \brief a hashtable node
  *
  *  Zero or more nodes can be added to a hashtable bucket. They are organized as
@@ -102,6 +120,21 @@ foreachNode(N* head, const F& func)
   }
 }
 
+/** \brief memory layout of a Hashtable
+ */
+enum class HashtableLayout {
+  /** \brief each bucket is a doubly linked list of separately allocated nodes
+   */
+  CHAINED,
+  /** \brief linear probing in a dense array of (hash, node index) slots, with nodes allocated
+   *         in chunks; a lookup reads consecutive slots and dereferences only candidate nodes
+   */
+  OPEN_ADDRESSING
+};
+
+std::ostream&
+operator<<(std::ostream& os, HashtableLayout layout);
+
 /** \brief provides options for Hashtable
  */
 class HashtableOptions
@@ -138,14 +171,24 @@ public:
   /** \brief when hashtable is shrunk, its new size is max(nBuckets*shrinkFactor, minSize)
    */
   float shrinkFactor = 0.5;
+
+  /** \brief memory layout
+   *
+   *  With OPEN_ADDRESSING, a bucket is a slot that holds at most one node, and
+   *  expandLoadFactor is capped at 0.9 so that probing always reaches an empty slot.
+   */
+  HashtableLayout layout = HashtableLayout::CHAINED;
 };
 
 /** \brief a hashtable for fast exact name lookup
  *
  *  The Hashtable contains a number of buckets.
  *  Each node is placed into a bucket determined by a hash value computed from its name.
- *  Hash collision is resolved through a doubly linked list in each bucket.
+ *  With the CHAINED layout, hash collision is resolved through a doubly linked list in each
+ *  bucket. With the OPEN_ADDRESSING layout, a node that collides is placed in the next free
+ *  bucket (linear probing).
  *  The number of buckets is adjusted according to how many nodes are stored.
+ *  Nodes never move in memory while they are in the hashtable.
  */
 class Hashtable
 {
@@ -172,7 +215,13 @@ public:
   size_t
   getNBuckets() const
   {
-    return m_buckets.size();
+    return m_options.layout == HashtableLayout::CHAINED ? m_buckets.size() : m_slots.size();
+  }
+
+  HashtableLayout
+  getLayout() const
+  {
+    return m_options.layout;
   }
 
   /** \return bucket index for hash value h
@@ -180,27 +229,41 @@ public:
   size_t
   computeBucketIndex(HashValue h) const
   {
-    return h % this->getNBuckets();
+    if (m_options.layout == HashtableLayout::CHAINED) {
+      return h % this->getNBuckets();
+    }
+    return computeSlotTag(h) % this->getNBuckets();
   }
 
   /** \return i-th bucket
    *  \pre bucket < getNBuckets()
+   *  \pre getLayout() == HashtableLayout::CHAINED
    */
   const Node*
   getBucket(size_t bucket) const
   {
+    BOOST_ASSERT(m_options.layout == HashtableLayout::CHAINED);
     BOOST_ASSERT(bucket < this->getNBuckets());
     return m_buckets[bucket]; // don't use m_bucket.at() for better performance
   }
 
+  /** \return first node in bucket order, or nullptr if the hashtable is empty
+   */
+  const Node*
+  getFirstNode() const;
+
+  /** \return node after \p node in bucket order, or nullptr if \p node is the last one
+   *  \pre node exists in this hashtable
+   */
+  const Node*
+  getNextNode(const Node* node) const;
+
   /** \brief find node for name.getPrefix(prefixLen)
    *  \pre name.size() > prefixLen
    */
   const Node*
   find(const Name& name, size_t prefixLen) const;
-  
-  
-  
+
   /** \brief find node for name.getPrefix(prefixLen)
    *  \pre name.size() > prefixLen
    *  \pre hashes == computeHashes(name)
@@ -214,10 +277,6 @@ public:
    */
   std::pair<const Node*, bool>
   insert(const Name& name, size_t prefixLen, const HashSequence& hashes);
-  
-  
-
-
 
   /** \brief delete node
    *  \pre node exists in this hashtable
@@ -239,77 +298,55 @@ public:
   std::pair<const Node*, bool>
   findOrInsert(const Name& name, size_t prefixLen, HashValue h, bool allowInsert);
 
- void
+  void
   computeThresholds();
 
   void
   resize(size_t newNBuckets);
-  
-  
-/****** BF *******/
 
-public:
+private: // open addressing
+  /** \brief a bucket of the OPEN_ADDRESSING layout
+   */
+  struct Slot
+  {
+    uint32_t tag; ///< computeSlotTag of the node hash
+    uint32_t index; ///< node index in m_chunks, or NO_NODE if the slot is empty
+  };
 
-void
-Entry_insert_name(const Name& name,  uint32_t x, uint32_t IoD);
+  static uint32_t
+  computeSlotTag(HashValue h)
+  {
+    return static_cast<uint32_t>(h);
+  }
 
-void
-Entry_insert_name2(const Name& name, uint32_t x, uint32_t y, uint32_t IoD);
-
-  
-uint32_t
- Entry_check_name1(const Name& name, uint32_t x, uint32_t IoD);
- 
- uint32_t
- Entry_check_name2(const Name& name,  uint32_t x,  uint32_t y, uint32_t IoD);
- 
- uint32_t
- Entry_check_input1(const Name& name, uint32_t IoD);
- 
- uint32_t
- Entry_check_input2(const Name& name, uint32_t x,  uint32_t y, uint32_t IoD);
- 
- uint32_t
- Entry_check_output2(const Name& name,  uint32_t x,  uint32_t y, uint32_t IoD);
-
- void
- Entry_clear_name(const Name& name,  uint32_t x,   uint32_t y, uint32_t IoD);
- 
- void
- Entry_clear_name1(const Name& name,  uint32_t x, uint32_t IoD);
- 
- void
- Entry_lock(const Name& name, uint32_t x,  uint32_t y, uint32_t IoD);
- 
- void
- BF_Periodic_check_fib_entries();
-
- 
- 
-
-  /****** BF *******/
-
-
- 
-/****** DMIF *******/
-
- uint32_t
- find_dmif(const Name& name, size_t prefixLen, uint32_t forwarderId, bool allowInsert, bool interest_or_data, uint32_t iOrd);
-    
- uint32_t
- findOrInsert_dmif(const Name& name, size_t prefixLen, uint32_t forwarderId, bool allowInsert, bool interest_or_data, uint32_t iOrd);
-
- uint32_t
- insert_dmif(const Name& name, size_t prefixLen,  uint32_t forwarderId, bool allowInsert, bool interest_or_data, uint32_t iOrd); 
- 
- void
- DMIF_PeriodicCheck_Fib_Entries();
-
- 
- 
-
-  /****** DMIF *******/
+  size_t
+  nextSlot(size_t slot) const
+  {
+    return slot + 1 == m_slots.size() ? 0 : slot + 1;
+  }
 
+  Node*
+  getChunkNode(uint32_t index) const
+  {
+    return reinterpret_cast<Node*>(&m_chunks[index / CHUNK_SIZE][index % CHUNK_SIZE]);
+  }
+
+  /** \return index of the slot that holds \p node
+   */
+  size_t
+  findSlot(const Node* node) const;
+
+  std::pair<const Node*, bool>
+  findOrInsertOpen(const Name& name, size_t prefixLen, HashValue h, bool allowInsert);
+
+  void
+  eraseOpen(Node* node);
+
+  void
+  resizeOpen(size_t newNSlots);
+
+  static const uint32_t NO_NODE = std::numeric_limits<uint32_t>::max();
+  static const uint32_t CHUNK_SIZE = 1024;
 
 private:
   std::vector<Node*> m_buckets;
@@ -317,11 +354,13 @@ private:
   size_t m_size;
   size_t m_expandThreshold;
   size_t m_shrinkThreshold;
- 
-  int m_BF_bool1=0;
-  int m_DMIF_bool1=0;
- 
-  ns3::EventId m_CheckEvent; ///< @brief Event to check whether or not retransmission should be performed
+
+  // OPEN_ADDRESSING layout: slots, and nodes in fixed-size chunks with a free list of indices
+  using NodeStorage = std::aligned_storage<sizeof(Node), alignof(Node)>::type;
+  std::vector<Slot> m_slots;
+  std::vector<unique_ptr<NodeStorage[]>> m_chunks;
+  std::vector<uint32_t> m_freeIndices;
+  uint32_t m_nIndices = 0; ///< number of indices handed out, including freed ones
 };
 
 } // namespace name_tree
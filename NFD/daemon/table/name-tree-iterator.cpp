@@ -114,43 +114,32 @@ FullEnumerationImpl::FullEnumerationImpl(const NameTree& nt, const EntrySelector
 void
 FullEnumerationImpl::advance(Iterator& i)
 {
+  const Node* node = nullptr;
+
   // find first entry
   if (i.m_entry == nullptr) {
-    for (size_t bucket = 0; bucket < ht.getNBuckets(); ++bucket) {
-      const Node* node = ht.getBucket(bucket);
-      if (node != nullptr) {
-        i.m_entry = &node->entry;
-        break;
-      }
-    }
-    if (i.m_entry == nullptr) { // empty enumerable
+    node = ht.getFirstNode();
+    if (node == nullptr) { // empty enumerable
       i = Iterator();
       return;
     }
-    if (m_pred(*i.m_entry)) { // visit first entry
+    if (m_pred(node->entry)) { // visit first entry
+      i.m_entry = &node->entry;
       return;
     }
   }
+  else {
+    node = getNode(*i.m_entry);
+  }
 
-  // process entries in same bucket
-  for (const Node* node = getNode(*i.m_entry)->next; node != nullptr; node = node->next) {
+  // process following entries in bucket order
+  for (node = ht.getNextNode(node); node != nullptr; node = ht.getNextNode(node)) {
     if (m_pred(node->entry)) {
       i.m_entry = &node->entry;
       return;
     }
   }
 
-  // process other buckets
-  size_t currentBucket = ht.computeBucketIndex(getNode(*i.m_entry)->hash);
-  for (size_t bucket = currentBucket + 1; bucket < ht.getNBuckets(); ++bucket) {
-    for (const Node* node = ht.getBucket(bucket); node != nullptr; node = node->next) {
-      if (m_pred(node->entry)) {
-        i.m_entry = &node->entry;
-        return;
-      }
-    }
-  }
-
   // reach the end
   i = Iterator();
 }
@@ -39,19 +39,33 @@ namespace name_tree {
 
 NFD_LOG_INIT(NameTree);
 
-NameTree::NameTree(size_t nBuckets)
-  : m_ht(HashtableOptions(nBuckets))
+static HashtableOptions
+makeHashtableOptions(size_t nBuckets, HashtableLayout layout)
+{
+  HashtableOptions options(nBuckets);
+  options.layout = layout;
+  return options;
+}
+
+NameTree::NameTree(size_t nBuckets, HashtableLayout layout)
+  : m_ht(makeHashtableOptions(nBuckets, layout))
 {
 }
 
 Entry&
 NameTree::lookup(const Name& name, size_t prefixLen)
+{
+  return this->lookup(name, prefixLen, computeHashes(name, prefixLen));
+}
+
+Entry&
+NameTree::lookup(const Name& name, size_t prefixLen, const HashSequence& hashes)
 {
   NFD_LOG_TRACE("lookup(" << name << ", " << prefixLen << ')');
   BOOST_ASSERT(prefixLen <= name.size());
   BOOST_ASSERT(prefixLen <= getMaxDepth());
+  BOOST_ASSERT(hashes.size() > prefixLen);
 
-  HashSequence hashes = computeHashes(name, prefixLen);
   const Node* node = nullptr;
   Entry* parent = nullptr;
 
@@ -173,7 +187,7 @@ NameTree::NameTree_findExactMatch_dmif(const Name& name, size_t prefixLen, uint3
                 if (prefixLen > getMaxDepth())  return 10000; 
 		
 		
-	        uint32_t fi1 =m_ht.findOrInsert_dmif(name, prefixLen, forwarderId, allowInsert, interest_or_data, iOrd);
+	        uint32_t fi1 =m_dmifTable.findOrInsert(name, forwarderId, allowInsert, interest_or_data, iOrd);
 	        return fi1;
 		 
 	       
@@ -190,13 +204,13 @@ NameTree::NameTree_findExactMatch_dmif(const Name& name, size_t prefixLen, uint3
 void
 NameTree::NameTree_insert_name(const Name& name,  uint32_t x, uint32_t IoD)
 {                                              	     
-   m_ht.Entry_insert_name(name, x, IoD);		         
+   m_bfTable.insert1(name, x, IoD);		         
 }
 
 void
 NameTree::NameTree_insert_name2(const Name& name,  uint32_t x, uint32_t y, uint32_t IoD)
 {                                              	     
-   m_ht.Entry_insert_name2(name, x, y, IoD);		         
+   m_bfTable.insert2(name, x, y, IoD);		         
 }
 	
 	
@@ -204,7 +218,7 @@ NameTree::NameTree_insert_name2(const Name& name,  uint32_t x, uint32_t y, uint3
 uint32_t		  
 NameTree::NameTree_check_name1(const Name& name,  uint32_t x, uint32_t IoD)
 {
- uint32_t counter=m_ht.Entry_check_name1(name, x, IoD);
+ uint32_t counter=m_bfTable.getCounter1(name, x, IoD);
  return counter;
 		         
 }	
@@ -212,7 +226,7 @@ NameTree::NameTree_check_name1(const Name& name,  uint32_t x, uint32_t IoD)
 uint32_t		  
 NameTree::NameTree_check_name2(const Name& name,  uint32_t x,  uint32_t y, uint32_t IoD)  
 {
- uint32_t counter=m_ht.Entry_check_name2(name, x,y, IoD);
+ uint32_t counter=m_bfTable.getCounter2(name, x, y, IoD);
  return counter;
 		         
 }
@@ -222,7 +236,7 @@ NameTree::NameTree_check_name2(const Name& name,  uint32_t x,  uint32_t y, uint3
 uint32_t		  
 NameTree::NameTree_check_input1(const Name& name, uint32_t IoD)
 {
-  uint32_t input=m_ht.Entry_check_input1(name, IoD);
+  uint32_t input=m_bfTable.getInput1(name, IoD);
  return input;
 		         
 }	
@@ -231,7 +245,7 @@ NameTree::NameTree_check_input1(const Name& name, uint32_t IoD)
 uint32_t		  
 NameTree::NameTree_check_input2(const Name& name,  uint32_t x,  uint32_t y, uint32_t IoD)
 {
-  uint32_t input=m_ht.Entry_check_input2(name, x, y, IoD);
+  uint32_t input=m_bfTable.getInput2(name, x, y, IoD);
  return input;
 		         
 }
@@ -239,7 +253,7 @@ NameTree::NameTree_check_input2(const Name& name,  uint32_t x,  uint32_t y, uint
 uint32_t		  
 NameTree::NameTree_check_output2(const Name& name,  uint32_t x,  uint32_t y, uint32_t IoD)    
 {
-  uint32_t output=m_ht.Entry_check_output2(name, x, y, IoD);
+  uint32_t output=m_bfTable.getOutput2(name, x, y, IoD);
  return output;
 		         
 }
@@ -249,14 +263,14 @@ NameTree::NameTree_check_output2(const Name& name,  uint32_t x,  uint32_t y, uin
 void
 NameTree::NameTree_lock (const Name& name, uint32_t x,  uint32_t y, uint32_t IoD)
 {	
-     m_ht.Entry_lock(name, x, y, IoD);
+     m_bfTable.lock(name, x, y, IoD);
 }
 
 
 void
 NameTree::NameTree_clear_name1(const Name& name, uint32_t x, uint32_t IoD)
 { 
-   m_ht.Entry_clear_name1(name, x, IoD);	
+   m_bfTable.erase1(name, x, IoD);	
 } 
 
 
@@ -264,7 +278,7 @@ NameTree::NameTree_clear_name1(const Name& name, uint32_t x, uint32_t IoD)
 void
 NameTree::NameTree_clear_name(const Name& name,  uint32_t x, uint32_t y, uint32_t IoD)
 { 
-   m_ht.Entry_clear_name(name, x, y, IoD);	
+   m_bfTable.erase2(name, x, y, IoD);	
 } 
 
 
@@ -278,7 +292,15 @@ Entry*
 NameTree::findLongestPrefixMatch(const Name& name, const EntrySelector& entrySelector) const
 {
   size_t depth = std::min(name.size(), getMaxDepth());
-  HashSequence hashes = computeHashes(name, depth);
+  return this->findLongestPrefixMatch(name, computeHashes(name, depth), entrySelector);
+}
+
+Entry*
+NameTree::findLongestPrefixMatch(const Name& name, const HashSequence& hashes,
+                                 const EntrySelector& entrySelector) const
+{
+  size_t depth = std::min(name.size(), getMaxDepth());
+  BOOST_ASSERT(hashes.size() > depth);
 
   for (ssize_t i = depth; i >= 0; --i) {
     const Node* node = m_ht.find(name, i, hashes);
@@ -338,6 +360,14 @@ NameTree::findAllMatches(const Name& name, const EntrySelector& entrySelector) c
   return {Iterator(make_shared<PrefixMatchImpl>(*this, entrySelector), entry), end()};
 }
 
+boost::iterator_range<NameTree::const_iterator>
+NameTree::findAllMatches(const Name& name, const HashSequence& hashes,
+                         const EntrySelector& entrySelector) const
+{
+  Entry* entry = this->findLongestPrefixMatch(name, hashes, entrySelector);
+  return {Iterator(make_shared<PrefixMatchImpl>(*this, entrySelector), entry), end()};
+}
+
 boost::iterator_range<NameTree::const_iterator>
 NameTree::fullEnumerate(const EntrySelector& entrySelector) const
 {
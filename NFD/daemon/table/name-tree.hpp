@@ -27,6 +27,8 @@
 #define NFD_DAEMON_TABLE_NAME_TREE_HPP
 
 #include "name-tree-iterator.hpp"
+#include "bf-table.hpp"
+#include "dmif-table.hpp"
 
 namespace nfd {
 namespace name_tree {
@@ -36,8 +38,11 @@ namespace name_tree {
 class NameTree : noncopyable
 {
 public:
+  /** \param nBuckets initial and minimum number of hashtable buckets
+   *  \param layout memory layout of the hashtable
+   */
   explicit
-  NameTree(size_t nBuckets = 1024);
+  NameTree(size_t nBuckets = 1024, HashtableLayout layout = HashtableLayout::CHAINED);
 
 public: // information
   /** \brief Maximum depth of the name tree
@@ -69,6 +74,14 @@ public: // information
     return m_ht.getNBuckets();
   }
 
+  /** \return memory layout of the hashtable
+   */
+  HashtableLayout
+  getLayout() const
+  {
+    return m_ht.getLayout();
+  }
+
   /** \return name tree entry on which a table entry is attached,
    *          or nullptr if the table entry is detached
    */
@@ -92,6 +105,12 @@ public: // mutation
   Entry&
   lookup(const Name& name, size_t prefixLen);
 
+  /** \brief Equivalent to `lookup(name, prefixLen)`, with precomputed hashes
+   *  \pre hashes[i] == computeHash(name, i) for i from 0 to \p prefixLen
+   */
+  Entry&
+  lookup(const Name& name, size_t prefixLen, const HashSequence& hashes);
+
   /** \brief Equivalent to `lookup(name, name.size())`
    */
   Entry&
@@ -209,6 +228,13 @@ NameTree_clear_name(const Name& name,  uint32_t x,  uint32_t y, uint32_t IoD);
   findLongestPrefixMatch(const Name& name,
                          const EntrySelector& entrySelector = AnyEntry()) const;
 
+  /** \brief Equivalent to `findLongestPrefixMatch(name, entrySelector)`, with precomputed hashes
+   *  \pre hashes[i] == computeHash(name, i) for i from 0 to min(name.size(), getMaxDepth())
+   */
+  Entry*
+  findLongestPrefixMatch(const Name& name, const HashSequence& hashes,
+                         const EntrySelector& entrySelector = AnyEntry()) const;
+
   /** \brief Equivalent to `findLongestPrefixMatch(entry.getName(), entrySelector)`
    *  \note This overload is more efficient than
    *        `findLongestPrefixMatch(const Name&, const EntrySelector&)` in common cases.
@@ -265,6 +291,13 @@ NameTree_clear_name(const Name& name,  uint32_t x,  uint32_t y, uint32_t IoD);
   findAllMatches(const Name& name,
                  const EntrySelector& entrySelector = AnyEntry()) const;
 
+  /** \brief Equivalent to `findAllMatches(name, entrySelector)`, with precomputed hashes
+   *  \pre hashes[i] == computeHash(name, i) for i from 0 to min(name.size(), getMaxDepth())
+   */
+  Range
+  findAllMatches(const Name& name, const HashSequence& hashes,
+                 const EntrySelector& entrySelector = AnyEntry()) const;
+
 public: // enumeration
   using const_iterator = Iterator;
 
@@ -326,6 +359,8 @@ public: // enumeration
 
 private:
   Hashtable m_ht;
+  BfTable m_bfTable;
+  DmifTable m_dmifTable;
 
   friend class EnumerationImpl;
 };
@@ -0,0 +1,202 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_PACKED_ARRAY_HPP
+#define NFD_DAEMON_TABLE_PACKED_ARRAY_HPP
+
+#include "core/common.hpp"
+
+namespace nfd {
+
+/** \brief a fixed-size array of unsigned integers of \p width bits, packed in 64-bit words
+ *
+ *  An element may straddle two words.
+ */
+class PackedArray
+{
+public:
+  PackedArray() = default;
+
+  /** \param size number of elements, initially zero
+   *  \param width bits of each element, 1 to 63
+   */
+  PackedArray(size_t size, unsigned width)
+    : m_size(size)
+    , m_width(width)
+    , m_mask((uint64_t(1) << width) - 1)
+    , m_words((size * width + 63) / 64, 0)
+  {
+    BOOST_ASSERT(width >= 1 && width <= 63);
+  }
+
+  uint64_t
+  get(size_t i) const
+  {
+    BOOST_ASSERT(i < m_size);
+    size_t bit = i * m_width;
+    size_t word = bit / 64;
+    unsigned offset = bit % 64;
+
+    uint64_t value = m_words[word] >> offset;
+    if (offset + m_width > 64) {
+      value |= m_words[word + 1] << (64 - offset);
+    }
+    return value & m_mask;
+  }
+
+  void
+  set(size_t i, uint64_t value)
+  {
+    BOOST_ASSERT(i < m_size);
+    BOOST_ASSERT(value <= m_mask);
+    size_t bit = i * m_width;
+    size_t word = bit / 64;
+    unsigned offset = bit % 64;
+
+    m_words[word] = (m_words[word] & ~(m_mask << offset)) | (value << offset);
+    if (offset + m_width > 64) {
+      unsigned shift = 64 - offset;
+      m_words[word + 1] = (m_words[word + 1] & ~(m_mask >> shift)) | (value >> shift);
+    }
+  }
+
+  size_t
+  size() const
+  {
+    return m_size;
+  }
+
+  unsigned
+  getWidth() const
+  {
+    return m_width;
+  }
+
+  /** \return number of bytes of the packed words
+   */
+  size_t
+  getMemoryUsage() const
+  {
+    return m_words.size() * sizeof(uint64_t);
+  }
+
+private:
+  size_t m_size = 0;
+  unsigned m_width = 1;
+  uint64_t m_mask = 1;
+  std::vector<uint64_t> m_words;
+};
+
+/** \brief a FIFO queue of unsigned integers of \p width bits, in a PackedArray ring buffer
+ *
+ *  The ring buffer doubles when it is full.
+ */
+class PackedQueue
+{
+public:
+  PackedQueue() = default;
+
+  /** \param width bits of each element, 1 to 63
+   */
+  explicit
+  PackedQueue(unsigned width)
+    : m_ring(0, width)
+  {
+  }
+
+  void
+  push_back(uint64_t value)
+  {
+    if (m_size == m_ring.size()) {
+      PackedArray ring(std::max<size_t>(m_ring.size() * 2, 64), m_ring.getWidth());
+      for (size_t i = 0; i < m_size; ++i) {
+        ring.set(i, (*this)[i]);
+      }
+      m_ring = std::move(ring);
+      m_head = 0;
+    }
+    m_ring.set((m_head + m_size) % m_ring.size(), value);
+    ++m_size;
+  }
+
+  uint64_t
+  front() const
+  {
+    BOOST_ASSERT(m_size > 0);
+    return m_ring.get(m_head);
+  }
+
+  void
+  pop_front()
+  {
+    BOOST_ASSERT(m_size > 0);
+    m_head = (m_head + 1) % m_ring.size();
+    --m_size;
+  }
+
+  /** \return the i-th oldest element
+   */
+  uint64_t
+  operator[](size_t i) const
+  {
+    BOOST_ASSERT(i < m_size);
+    return m_ring.get((m_head + i) % m_ring.size());
+  }
+
+  size_t
+  size() const
+  {
+    return m_size;
+  }
+
+  bool
+  empty() const
+  {
+    return m_size == 0;
+  }
+
+  unsigned
+  getWidth() const
+  {
+    return m_ring.getWidth();
+  }
+
+  /** \return number of bytes of the ring buffer
+   */
+  size_t
+  getMemoryUsage() const
+  {
+    return m_ring.getMemoryUsage();
+  }
+
+private:
+  PackedArray m_ring;
+  size_t m_head = 0;
+  size_t m_size = 0;
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_PACKED_ARRAY_HPP
@@ -26,10 +26,11 @@
 #ifndef NFD_DAEMON_TABLE_PIT_ENTRY_HPP
 #define NFD_DAEMON_TABLE_PIT_ENTRY_HPP
 
+#include "pit-expiry-wheel.hpp"
 #include "pit-in-record.hpp"
 #include "pit-out-record.hpp"
 
-#include <list>
+#include <boost/container/small_vector.hpp>
 
 namespace nfd {
 
@@ -39,13 +40,24 @@ class Entry;
 
 namespace pit {
 
+/** \brief number of in-records or out-records stored inside a PIT entry
+ *
+ *  Most entries have a single downstream and a single upstream, often the same ad hoc face,
+ *  and do not allocate memory for their records.
+ */
+const size_t FACE_RECORDS_INLINE_CAPACITY = 1;
+
 /** \brief An unordered collection of in-records
+ *  \note Inserting or deleting an in-record invalidates iterators and references to the
+ *        other in-records.
  */
-typedef std::list<InRecord> InRecordCollection;
+typedef boost::container::small_vector<InRecord, FACE_RECORDS_INLINE_CAPACITY> InRecordCollection;
 
 /** \brief An unordered collection of out-records
+ *  \note Inserting or deleting an out-record invalidates iterators and references to the
+ *        other out-records.
  */
-typedef std::list<OutRecord> OutRecordCollection;
+typedef boost::container::small_vector<OutRecord, FACE_RECORDS_INLINE_CAPACITY> OutRecordCollection;
 
 /** \brief An Interest table entry
  *
@@ -219,8 +231,9 @@ public:
   /** \brief Expiry timer
    *
    *  This timer is used in forwarding pipelines to delete the entry
+   *  \sa Forwarder::setExpiryTimer
    */
-  scheduler::EventId expiryTimer;
+  ExpiryTimer expiryTimer;
 
   /** \brief Indicates whether this PIT entry is satisfied
    */
@@ -0,0 +1,277 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pit-expiry-wheel.hpp"
+
+#include "ns3/simulator.h"
+
+#include <algorithm>
+
+namespace nfd {
+namespace pit {
+
+constexpr uint8_t ExpiryWheel::N_LEVELS;
+constexpr uint8_t ExpiryWheel::DUE_LEVEL;
+constexpr uint64_t ExpiryWheel::LEVEL0_SIZE;
+constexpr uint64_t ExpiryWheel::LEVEL_SIZE;
+constexpr uint64_t ExpiryWheel::MAX_DELTA;
+
+static const int64_t NS_PER_TICK = 1000000;
+
+void
+ExpiryTimer::cancel()
+{
+  if (m_wheel != nullptr) {
+    m_wheel->cancel(*this);
+  }
+}
+
+ExpiryWheel::ExpiryWheel(ExpiryCallback onExpiry)
+  : m_onExpiry(std::move(onExpiry))
+{
+}
+
+ExpiryWheel::~ExpiryWheel()
+{
+  auto detach = [] (TimerList& list) {
+    list.clear_and_dispose([] (ExpiryTimer* timer) {
+      timer->m_wheel = nullptr;
+      timer->m_entry.reset();
+    });
+  };
+
+  for (auto& slot : m_level0) {
+    detach(slot);
+  }
+  for (auto& level : m_upperLevels) {
+    for (auto& slot : level) {
+      detach(slot);
+    }
+  }
+  detach(m_due);
+
+  m_tickEvent.Cancel();
+  m_dueEvent.Cancel();
+}
+
+uint64_t
+ExpiryWheel::toTick(int64_t timeNs, bool isRoundedUp)
+{
+  BOOST_ASSERT(timeNs >= 0);
+  uint64_t tick = static_cast<uint64_t>(timeNs / NS_PER_TICK);
+  if (isRoundedUp && timeNs % NS_PER_TICK != 0) {
+    ++tick;
+  }
+  return tick;
+}
+
+ExpiryWheel::TimerList&
+ExpiryWheel::getSlot(uint8_t level, uint64_t tick)
+{
+  if (level == 0) {
+    return m_level0[tick & (LEVEL0_SIZE - 1)];
+  }
+  unsigned shift = LEVEL0_BITS + (level - 1) * LEVEL_BITS;
+  return m_upperLevels[level - 1][(tick >> shift) & (LEVEL_SIZE - 1)];
+}
+
+bool
+ExpiryWheel::isEmpty() const
+{
+  return std::all_of(m_levelSizes.begin(), m_levelSizes.end(),
+                     [] (size_t levelSize) { return levelSize == 0; });
+}
+
+void
+ExpiryWheel::schedule(ExpiryTimer& timer, const shared_ptr<Entry>& entry,
+                      time::milliseconds duration)
+{
+  BOOST_ASSERT(entry != nullptr);
+  timer.cancel();
+
+  timer.m_wheel = this;
+  timer.m_entry = entry;
+  ++m_size;
+
+  if (duration <= 0_ms) {
+    timer.m_level = DUE_LEVEL;
+    m_due.push_back(timer);
+    if (!m_dueEvent.IsRunning()) {
+      m_dueEvent = ns3::Simulator::ScheduleNow(&ExpiryWheel::onDue, this);
+    }
+    return;
+  }
+
+  int64_t now = ns3::Simulator::Now().GetNanoSeconds();
+  if (this->isEmpty()) {
+    // nothing depends on the previous position of the wheel
+    m_currentTick = toTick(now, true);
+  }
+  timer.m_expiry = toTick(now + time::duration_cast<time::nanoseconds>(duration).count(), true);
+  this->insert(timer);
+
+  // the tick at which the wheel must look at this timer: its expiry for level 0,
+  // otherwise the next cascade
+  uint64_t tick = timer.m_level == 0 ? timer.m_expiry :
+                  (m_currentTick + LEVEL0_SIZE - 1) & ~(LEVEL0_SIZE - 1);
+  if (!m_tickEvent.IsRunning() || tick < m_tickEventTick) {
+    this->scheduleTick();
+  }
+}
+
+void
+ExpiryWheel::insert(ExpiryTimer& timer)
+{
+  uint64_t expiry = std::max(timer.m_expiry, m_currentTick);
+  uint64_t delta = expiry - m_currentTick;
+
+  uint8_t level = 0;
+  for (uint64_t span = LEVEL0_SIZE; delta >= span && level < N_LEVELS - 1; span <<= LEVEL_BITS) {
+    ++level;
+  }
+  if (delta >= MAX_DELTA) {
+    // inserted into the farthest slot, and cascaded again from there
+    expiry = m_currentTick + MAX_DELTA - 1;
+  }
+
+  timer.m_level = level;
+  this->getSlot(level, expiry).push_back(timer);
+  ++m_levelSizes[level];
+}
+
+void
+ExpiryWheel::cancel(ExpiryTimer& timer)
+{
+  BOOST_ASSERT(timer.m_wheel == this);
+
+  timer.m_hook.unlink();
+  if (timer.m_level < N_LEVELS) {
+    --m_levelSizes[timer.m_level];
+  }
+  --m_size;
+  timer.m_wheel = nullptr;
+  timer.m_entry.reset();
+
+  if (this->isEmpty()) {
+    m_tickEvent.Cancel();
+  }
+}
+
+void
+ExpiryWheel::cascade(uint8_t level)
+{
+  TimerList timers;
+  timers.splice(timers.end(), this->getSlot(level, m_currentTick));
+
+  while (!timers.empty()) {
+    ExpiryTimer& timer = timers.front();
+    timers.pop_front();
+    --m_levelSizes[level];
+    this->insert(timer);
+  }
+}
+
+void
+ExpiryWheel::fire(TimerList& list)
+{
+  // the callback may start or cancel any timer, including those remaining in the list
+  while (!list.empty()) {
+    ExpiryTimer& timer = list.front();
+    list.pop_front();
+    if (timer.m_level < N_LEVELS) {
+      --m_levelSizes[timer.m_level];
+    }
+    --m_size;
+    timer.m_wheel = nullptr;
+
+    shared_ptr<Entry> entry = timer.m_entry.lock();
+    timer.m_entry.reset();
+    if (entry != nullptr) {
+      m_onExpiry(entry);
+    }
+  }
+}
+
+void
+ExpiryWheel::scheduleTick()
+{
+  m_tickEvent.Cancel();
+  if (this->isEmpty()) {
+    return;
+  }
+
+  // timers in level 0 expire within LEVEL0_SIZE ticks; if there are timers in the other levels,
+  // the wheel must also stop at the next cascade
+  bool hasUpperLevels = std::any_of(m_levelSizes.begin() + 1, m_levelSizes.end(),
+                                    [] (size_t levelSize) { return levelSize > 0; });
+  uint64_t last = m_currentTick + LEVEL0_SIZE - 1;
+  if (hasUpperLevels) {
+    last = (m_currentTick + LEVEL0_SIZE - 1) & ~(LEVEL0_SIZE - 1);
+  }
+
+  uint64_t next = m_currentTick;
+  while (next < last && m_level0[next & (LEVEL0_SIZE - 1)].empty()) {
+    ++next;
+  }
+
+  int64_t delay = std::max<int64_t>(static_cast<int64_t>(next) * NS_PER_TICK -
+                                    ns3::Simulator::Now().GetNanoSeconds(), 0);
+  m_tickEventTick = next;
+  m_tickEvent = ns3::Simulator::Schedule(ns3::NanoSeconds(delay), &ExpiryWheel::onTick, this);
+}
+
+void
+ExpiryWheel::onTick()
+{
+  uint64_t now = toTick(ns3::Simulator::Now().GetNanoSeconds(), false);
+
+  while (m_currentTick <= now && !this->isEmpty()) {
+    for (uint8_t level = 1; level < N_LEVELS; ++level) {
+      unsigned shift = LEVEL0_BITS + (level - 1) * LEVEL_BITS;
+      if ((m_currentTick & ((uint64_t(1) << shift) - 1)) != 0) {
+        break;
+      }
+      this->cascade(level);
+    }
+
+    // timers started by the callbacks expire after the current tick, and are never inserted
+    // into the slot being fired
+    this->fire(m_level0[m_currentTick & (LEVEL0_SIZE - 1)]);
+    ++m_currentTick;
+  }
+
+  this->scheduleTick();
+}
+
+void
+ExpiryWheel::onDue()
+{
+  TimerList timers;
+  timers.splice(timers.end(), m_due);
+  this->fire(timers);
+}
+
+} // namespace pit
+} // namespace nfd
@@ -0,0 +1,200 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_PIT_EXPIRY_WHEEL_HPP
+#define NFD_DAEMON_TABLE_PIT_EXPIRY_WHEEL_HPP
+
+#include "core/common.hpp"
+
+#include "ns3/event-id.h"
+
+#include <boost/intrusive/list.hpp>
+
+#include <array>
+
+namespace nfd {
+namespace pit {
+
+class Entry;
+class ExpiryWheel;
+
+/** \brief expiry timer of a PIT entry
+ *
+ *  The timer is embedded in the PIT entry and linked into an ExpiryWheel while it is running,
+ *  so that starting and canceling it does not allocate memory. It is canceled automatically
+ *  when the PIT entry is destructed.
+ */
+class ExpiryTimer : noncopyable
+{
+public:
+  ExpiryTimer() = default;
+
+  ~ExpiryTimer()
+  {
+    this->cancel();
+  }
+
+  /** \brief stop the timer if it is running
+   */
+  void
+  cancel();
+
+  /** \retval true the timer is running
+   *  \retval false the timer has fired, has been canceled, or has never been started
+   */
+  explicit
+  operator bool() const
+  {
+    return m_wheel != nullptr;
+  }
+
+private:
+  using Hook = boost::intrusive::list_member_hook<
+    boost::intrusive::link_mode<boost::intrusive::auto_unlink>>;
+
+  Hook m_hook;
+  ExpiryWheel* m_wheel = nullptr;
+  weak_ptr<Entry> m_entry;
+  uint64_t m_expiry = 0; ///< expiry tick, in milliseconds since the start of the simulation
+  uint8_t m_level = 0; ///< wheel level, or DUE_LEVEL
+
+  friend ExpiryWheel;
+};
+
+/** \brief a hierarchical timing wheel for the expiry timers of PIT entries
+ *
+ *  Time is divided into ticks of one millisecond. The first level of the wheel has one slot per
+ *  tick for the next 256 ticks; each of the three following levels has 64 slots, each covering
+ *  as many ticks as the whole previous level. A timer is inserted into the lowest level that
+ *  covers its expiry tick, and moved down a level ("cascaded") when the wheel reaches the
+ *  beginning of its slot; timers due later than the highest level covers (about 18 hours) are
+ *  cascaded until they fit. Starting, canceling, and firing a timer take constant time.
+ *
+ *  A timer fires at the first tick boundary at or after its expiry time, that is, at most one
+ *  millisecond late. A zero duration fires the timer without delay, in a new simulator event.
+ *
+ *  The wheel schedules one ns-3 event for the next slot that holds timers (or the next slot where
+ *  timers have to be cascaded), rather than an event for every timer or for every tick.
+ */
+class ExpiryWheel : noncopyable
+{
+public:
+  /** \brief a function called when the timer of a PIT entry fires
+   */
+  using ExpiryCallback = std::function<void(const shared_ptr<Entry>&)>;
+
+  explicit
+  ExpiryWheel(ExpiryCallback onExpiry);
+
+  ~ExpiryWheel();
+
+  /** \brief (re)start the timer of \p entry to fire after \p duration
+   *  \param timer the timer embedded in \p entry
+   */
+  void
+  schedule(ExpiryTimer& timer, const shared_ptr<Entry>& entry, time::milliseconds duration);
+
+  /** \return number of running timers
+   */
+  size_t
+  size() const
+  {
+    return m_size;
+  }
+
+private:
+  using TimerList = boost::intrusive::list<ExpiryTimer,
+    boost::intrusive::member_hook<ExpiryTimer, ExpiryTimer::Hook, &ExpiryTimer::m_hook>,
+    boost::intrusive::constant_time_size<false>>;
+
+  /** \return the tick at \p timeNs, rounded down or up to a whole millisecond
+   */
+  static uint64_t
+  toTick(int64_t timeNs, bool isRoundedUp);
+
+  TimerList&
+  getSlot(uint8_t level, uint64_t tick);
+
+  bool
+  isEmpty() const;
+
+  void
+  insert(ExpiryTimer& timer);
+
+  void
+  cancel(ExpiryTimer& timer);
+
+  /** \brief move the timers of the current slot of \p level to lower levels
+   */
+  void
+  cascade(uint8_t level);
+
+  void
+  fire(TimerList& list);
+
+  /** \brief schedule the ns-3 event for the next slot that must be processed
+   */
+  void
+  scheduleTick();
+
+  /** \brief process all slots until the current tick
+   */
+  void
+  onTick();
+
+  /** \brief fire the timers that were started with zero duration
+   */
+  void
+  onDue();
+
+private:
+  static constexpr uint8_t N_LEVELS = 4;
+  static constexpr uint8_t DUE_LEVEL = N_LEVELS;
+  static constexpr unsigned LEVEL0_BITS = 8;
+  static constexpr unsigned LEVEL_BITS = 6;
+  static constexpr uint64_t LEVEL0_SIZE = uint64_t(1) << LEVEL0_BITS;
+  static constexpr uint64_t LEVEL_SIZE = uint64_t(1) << LEVEL_BITS;
+  static constexpr uint64_t MAX_DELTA = uint64_t(1) << (LEVEL0_BITS + (N_LEVELS - 1) * LEVEL_BITS);
+
+  ExpiryCallback m_onExpiry;
+
+  std::array<TimerList, LEVEL0_SIZE> m_level0;
+  std::array<std::array<TimerList, LEVEL_SIZE>, N_LEVELS - 1> m_upperLevels;
+  std::array<size_t, N_LEVELS> m_levelSizes{};
+  TimerList m_due;
+  size_t m_size = 0;
+
+  uint64_t m_currentTick = 0; ///< the next tick to be processed
+  uint64_t m_tickEventTick = 0; ///< the tick at which m_tickEvent runs
+  ns3::EventId m_tickEvent;
+  ns3::EventId m_dueEvent;
+
+  friend ExpiryTimer;
+};
+
+} // namespace pit
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_PIT_EXPIRY_WHEEL_HPP
@@ -79,12 +79,27 @@ public:
     return this->findOrInsert(interest, true);
   }
 
+  /** \brief Inserts a PIT entry for \p interest, with precomputed hashes of its Name
+   *  \pre hashes == name_tree::computeHashes(interest.getName())
+   */
+  std::pair<shared_ptr<Entry>, bool>
+  insert(const Interest& interest, const name_tree::HashSequence& hashes)
+  {
+    return this->findOrInsert(interest, true, &hashes);
+  }
+
   /** \brief Performs a Data match
    *  \return an iterable of all PIT entries matching \p data
    */
   DataMatchResult
   findAllDataMatches(const Data& data) const;
 
+  /** \brief Performs a Data match, with precomputed hashes of the Data name
+   *  \pre hashes == name_tree::computeHashes(data.getName())
+   */
+  DataMatchResult
+  findAllDataMatches(const Data& data, const name_tree::HashSequence& hashes) const;
+
   /** \brief Deletes an entry
    */
   void
@@ -125,13 +140,15 @@ private:
   /** \brief Finds or inserts a PIT entry for \p interest
    *  \param interest the Interest; must be created with make_shared if allowInsert
    *  \param allowInsert whether inserting a new entry is allowed
+   *  \param hashes name_tree::computeHashes of the Interest name, or nullptr to compute them
    *  \return if allowInsert, a new or existing entry with same Name+Selectors,
    *          and true for new entry, false for existing entry;
    *          if not allowInsert, an existing entry with same Name+Selectors and false,
    *          or `{nullptr, true}` if there's no existing entry
    */
   std::pair<shared_ptr<Entry>, bool>
-  findOrInsert(const Interest& interest, bool allowInsert);
+  findOrInsert(const Interest& interest, bool allowInsert,
+               const name_tree::HashSequence* hashes = nullptr);
 
 private:
   NameTree& m_nameTree;
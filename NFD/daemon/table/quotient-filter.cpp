@@ -0,0 +1,227 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "quotient-filter.hpp"
+
+#include <algorithm>
+
+namespace nfd {
+
+const unsigned QuotientFilter::MAX_REMAINDER_BITS = 29;
+
+// metadata bits of a slot; the remainder is stored above them
+//  - OCCUPIED: some fingerprint has this slot as its quotient
+//  - CONTINUATION: the remainder is not the first one of its run
+//  - SHIFTED: the remainder is not stored in the slot of its quotient
+// A slot is empty if none of these bits is set.
+static const uint32_t OCCUPIED = 1 << 0;
+static const uint32_t CONTINUATION = 1 << 1;
+static const uint32_t SHIFTED = 1 << 2;
+static const uint32_t METADATA = OCCUPIED | CONTINUATION | SHIFTED;
+static const unsigned METADATA_BITS = 3;
+
+QuotientFilter::QuotientFilter(unsigned quotientBits, unsigned remainderBits)
+  : m_quotientBits(quotientBits)
+  , m_remainderBits(remainderBits)
+  , m_mask((size_t(1) << quotientBits) - 1)
+  , m_slots(size_t(1) << quotientBits, remainderBits + METADATA_BITS)
+{
+  BOOST_ASSERT(quotientBits >= 1 && quotientBits <= 32);
+  BOOST_ASSERT(remainderBits >= 1 && remainderBits <= MAX_REMAINDER_BITS);
+}
+
+size_t
+QuotientFilter::findRun(size_t q) const
+{
+  BOOST_ASSERT((getSlot(q) & OCCUPIED) != 0);
+
+  // walk back to the start of the cluster
+  size_t b = q;
+  while ((getSlot(b) & SHIFTED) != 0) {
+    b = prev(b);
+  }
+
+  // walk forward, skipping one run for each occupied slot before q
+  size_t s = b;
+  while (b != q) {
+    do {
+      s = next(s);
+    } while ((getSlot(s) & CONTINUATION) != 0);
+    do {
+      b = next(b);
+    } while ((getSlot(b) & OCCUPIED) == 0);
+  }
+  return s;
+}
+
+bool
+QuotientFilter::contains(uint64_t hash) const
+{
+  size_t q = getQuotient(hash);
+  Slot r = getRemainder(hash);
+  if ((getSlot(q) & OCCUPIED) == 0) {
+    return false;
+  }
+
+  // remainders in a run are sorted
+  size_t s = findRun(q);
+  do {
+    Slot remainder = getSlot(s) >> METADATA_BITS;
+    if (remainder == r) {
+      return true;
+    }
+    if (remainder > r) {
+      return false;
+    }
+    s = next(s);
+  } while ((getSlot(s) & CONTINUATION) != 0);
+  return false;
+}
+
+void
+QuotientFilter::insert(uint64_t hash)
+{
+  BOOST_ASSERT(m_size < m_slots.size());
+
+  size_t q = getQuotient(hash);
+  Slot r = getRemainder(hash);
+  ++m_size;
+
+  if ((getSlot(q) & METADATA) == 0) {
+    m_slots.set(q, (r << METADATA_BITS) | OCCUPIED);
+    return;
+  }
+
+  // The slots from the start of the cluster to the next empty slot are decoded, and written
+  // again with the new fingerprint. The new layout takes at most one more slot, which is the
+  // empty slot.
+  size_t start = q;
+  while ((getSlot(start) & SHIFTED) != 0) {
+    start = prev(start);
+  }
+
+  m_scratch.clear();
+  size_t quotient = start;
+  size_t i = start;
+  do {
+    if (!m_scratch.empty() && (getSlot(i) & CONTINUATION) == 0) {
+      do {
+        quotient = next(quotient);
+      } while ((getSlot(quotient) & OCCUPIED) == 0);
+    }
+    m_scratch.emplace_back(quotient, getSlot(i) >> METADATA_BITS);
+    i = next(i);
+  } while ((getSlot(i) & METADATA) != 0);
+  size_t nOldSlots = m_scratch.size();
+
+  auto offset = [this, start] (size_t slot) { return (slot - start) & m_mask; };
+  auto pos = std::upper_bound(m_scratch.begin(), m_scratch.end(), std::make_pair(q, r),
+    [&offset] (const std::pair<size_t, Slot>& a, const std::pair<size_t, Slot>& b) {
+      return offset(a.first) < offset(b.first) ||
+             (offset(a.first) == offset(b.first) && a.second < b.second);
+    });
+  m_scratch.emplace(pos, q, r);
+
+  this->rewrite(start, nOldSlots);
+}
+
+bool
+QuotientFilter::erase(uint64_t hash)
+{
+  if (!this->contains(hash)) {
+    return false;
+  }
+
+  size_t q = getQuotient(hash);
+  Slot r = getRemainder(hash);
+
+  size_t start = q;
+  while ((getSlot(start) & SHIFTED) != 0) {
+    start = prev(start);
+  }
+
+  // decode the cluster, leaving out one occurrence of the fingerprint; the slots after the
+  // cluster do not move, because their first remainder is in the slot of its quotient
+  m_scratch.clear();
+  size_t quotient = start;
+  size_t i = start;
+  size_t nOldSlots = 0;
+  bool isErased = false;
+  do {
+    if (nOldSlots > 0 && (getSlot(i) & CONTINUATION) == 0) {
+      do {
+        quotient = next(quotient);
+      } while ((getSlot(quotient) & OCCUPIED) == 0);
+    }
+    Slot remainder = getSlot(i) >> METADATA_BITS;
+    if (!isErased && quotient == q && remainder == r) {
+      isErased = true;
+    }
+    else {
+      m_scratch.emplace_back(quotient, remainder);
+    }
+    ++nOldSlots;
+    i = next(i);
+  } while ((getSlot(i) & METADATA) != 0 && (getSlot(i) & SHIFTED) != 0);
+  BOOST_ASSERT(isErased);
+
+  --m_size;
+  this->rewrite(start, nOldSlots);
+  return true;
+}
+
+void
+QuotientFilter::rewrite(size_t start, size_t nOldSlots)
+{
+  for (size_t k = 0, i = start; k < nOldSlots; ++k, i = next(i)) {
+    m_slots.set(i, 0);
+  }
+  for (const auto& pair : m_scratch) {
+    m_slots.set(pair.first, getSlot(pair.first) | OCCUPIED);
+  }
+
+  size_t pos = 0;
+  for (size_t k = 0; k < m_scratch.size(); ++k) {
+    size_t quotient = m_scratch[k].first;
+    size_t quotientPos = (quotient - start) & m_mask;
+    bool isRunStart = k == 0 || quotient != m_scratch[k - 1].first;
+    if (isRunStart) {
+      pos = std::max(pos, quotientPos);
+    }
+
+    size_t i = (start + pos) & m_mask;
+    Slot slot = (m_scratch[k].second << METADATA_BITS) | (getSlot(i) & OCCUPIED);
+    if (!isRunStart) {
+      slot |= CONTINUATION;
+    }
+    if (pos != quotientPos) {
+      slot |= SHIFTED;
+    }
+    m_slots.set(i, slot);
+    ++pos;
+  }
+}
+
+} // namespace nfd
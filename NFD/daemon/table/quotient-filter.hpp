@@ -0,0 +1,167 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_QUOTIENT_FILTER_HPP
+#define NFD_DAEMON_TABLE_QUOTIENT_FILTER_HPP
+
+#include "packed-array.hpp"
+
+namespace nfd {
+
+/** \brief a counting quotient filter of 64-bit hash values
+ *
+ *  The low quotientBits + remainderBits bits of a hash form its fingerprint. The quotient
+ *  (upper part of the fingerprint) selects one of 2^quotientBits slots, and the remainder is
+ *  stored in that slot or, by linear probing, in a following one, together with three
+ *  metadata bits that allow the quotient to be recovered. Slots are packed, so that each takes
+ *  remainderBits + 3 bits. The same fingerprint may be inserted several times, and erase()
+ *  removes one occurrence.
+ *
+ *  A query for a hash that was not inserted returns true with a probability of about
+ *  load * 2^-remainderBits, where load is size() / getNSlots().
+ */
+class QuotientFilter : noncopyable
+{
+public:
+  /** \param quotientBits log2 of the number of slots, 1 to 32
+   *  \param remainderBits stored bits of each fingerprint, 1 to MAX_REMAINDER_BITS
+   */
+  QuotientFilter(unsigned quotientBits, unsigned remainderBits);
+
+  /** \return whether the fingerprint of \p hash may have been inserted
+   */
+  bool
+  contains(uint64_t hash) const;
+
+  /** \brief insert the fingerprint of \p hash
+   *  \pre size() < getNSlots()
+   */
+  void
+  insert(uint64_t hash);
+
+  /** \brief erase one occurrence of the fingerprint of \p hash
+   *  \return whether the fingerprint was found
+   */
+  bool
+  erase(uint64_t hash);
+
+  /** \return number of stored fingerprints
+   */
+  size_t
+  size() const
+  {
+    return m_size;
+  }
+
+  size_t
+  getNSlots() const
+  {
+    return m_slots.size();
+  }
+
+  unsigned
+  getQuotientBits() const
+  {
+    return m_quotientBits;
+  }
+
+  unsigned
+  getRemainderBits() const
+  {
+    return m_remainderBits;
+  }
+
+  /** \return number of bytes of the slots
+   */
+  size_t
+  getMemoryUsage() const
+  {
+    return m_slots.getMemoryUsage();
+  }
+
+public:
+  static const unsigned MAX_REMAINDER_BITS;
+
+private:
+  using Slot = uint32_t;
+
+  size_t
+  next(size_t i) const
+  {
+    return (i + 1) & m_mask;
+  }
+
+  size_t
+  prev(size_t i) const
+  {
+    return (i - 1) & m_mask;
+  }
+
+  Slot
+  getSlot(size_t i) const
+  {
+    return static_cast<Slot>(m_slots.get(i));
+  }
+
+  size_t
+  getQuotient(uint64_t hash) const
+  {
+    return static_cast<size_t>(hash >> m_remainderBits) & m_mask;
+  }
+
+  Slot
+  getRemainder(uint64_t hash) const
+  {
+    return static_cast<Slot>(hash & ((uint64_t(1) << m_remainderBits) - 1));
+  }
+
+  /** \return the slot where the run of quotient \p q starts
+   *  \pre slot q is occupied
+   */
+  size_t
+  findRun(size_t q) const;
+
+  /** \brief rewrite the slots from \p start, which is the start of a cluster, with the
+   *         (quotient, remainder) pairs in m_scratch
+   *  \param nOldSlots number of slots from \p start that held the pairs before
+   */
+  void
+  rewrite(size_t start, size_t nOldSlots);
+
+private:
+  unsigned m_quotientBits;
+  unsigned m_remainderBits;
+  size_t m_mask;
+  PackedArray m_slots;
+  size_t m_size = 0;
+
+  /** \brief (quotient, remainder) pairs of the slots being rewritten, reused between calls
+   */
+  std::vector<std::pair<size_t, Slot>> m_scratch;
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_QUOTIENT_FILTER_HPP
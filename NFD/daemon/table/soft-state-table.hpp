@@ -0,0 +1,279 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_SOFT_STATE_TABLE_HPP
+#define NFD_DAEMON_TABLE_SOFT_STATE_TABLE_HPP
+
+#include "name-tree-hashtable.hpp"
+
+#include <ns3/nstime.h>
+
+namespace nfd {
+
+/** \brief an open-addressing table of timestamped records keyed by name
+ *  \tparam T record value, compared by the caller through a predicate
+ *
+ *  Several records may share a name. Records are stored in a pool and indexed by an array of
+ *  slots, which is probed linearly from the hash of the record name; records with the same name
+ *  therefore sit in one probe run, in insertion order. Erasing uses backward-shift deletion, so
+ *  that no tombstones accumulate.
+ *
+ *  Records can be linked into an expiry list in insertion order. Because a record's timestamp is
+ *  assigned at insertion, the list is also ordered by timestamp, and expire() visits only the
+ *  records that actually expire.
+ *
+ *  This is the storage of BfTable and DmifTable, and is not meant to be used directly.
+ */
+template<typename T>
+class SoftStateTable : noncopyable
+{
+public:
+  struct Record
+  {
+    Name name;
+    name_tree::HashValue hash = 0;
+    ns3::Time timestamp;
+    T value;
+
+    bool isInExpiryList = false;
+    uint32_t expiryPrev = NONE;
+    uint32_t expiryNext = NONE;
+  };
+
+  SoftStateTable()
+    : m_slots(INITIAL_N_SLOTS, NONE)
+  {
+  }
+
+  /** \return number of records
+   */
+  size_t
+  size() const
+  {
+    return m_size;
+  }
+
+  /** \brief find the most recently inserted record with \p name whose value satisfies \p pred
+   *  \pre h == computeHash(name)
+   *  \return the record, or nullptr if it does not exist
+   */
+  template<typename F>
+  Record*
+  find(const Name& name, name_tree::HashValue h, const F& pred)
+  {
+    Record* found = nullptr;
+    size_t mask = m_slots.size() - 1;
+    for (size_t i = h & mask; m_slots[i] != NONE; i = (i + 1) & mask) {
+      Record& record = m_records[m_slots[i]];
+      if (record.hash == h && pred(record.value) && record.name == name) {
+        found = &record;
+      }
+    }
+    return found;
+  }
+
+  /** \brief insert a record
+   *  \param isExpiring whether the record is appended to the expiry list
+   *  \pre h == computeHash(name)
+   *  \pre if \p isExpiring, \p timestamp is not older than any record in the expiry list
+   */
+  Record&
+  insert(const Name& name, name_tree::HashValue h, const ns3::Time& timestamp, const T& value,
+         bool isExpiring)
+  {
+    if ((m_size + 1) * 2 > m_slots.size()) {
+      this->rehash(m_slots.size() * 2);
+    }
+
+    uint32_t index;
+    if (m_freeRecords.empty()) {
+      index = static_cast<uint32_t>(m_records.size());
+      m_records.emplace_back();
+    }
+    else {
+      index = m_freeRecords.back();
+      m_freeRecords.pop_back();
+    }
+
+    Record& record = m_records[index];
+    record.name = name;
+    record.hash = h;
+    record.timestamp = timestamp;
+    record.value = value;
+
+    size_t mask = m_slots.size() - 1;
+    size_t i = h & mask;
+    while (m_slots[i] != NONE) {
+      i = (i + 1) & mask;
+    }
+    m_slots[i] = index;
+    ++m_size;
+
+    if (isExpiring) {
+      this->appendToExpiryList(index);
+    }
+    return record;
+  }
+
+  /** \brief erase a record
+   *  \pre record was returned by find() or insert() and has not been erased
+   */
+  void
+  erase(Record& record)
+  {
+    uint32_t index = static_cast<uint32_t>(&record - m_records.data());
+    BOOST_ASSERT(index < m_records.size());
+
+    size_t mask = m_slots.size() - 1;
+    size_t i = record.hash & mask;
+    while (m_slots[i] != index) {
+      BOOST_ASSERT(m_slots[i] != NONE);
+      i = (i + 1) & mask;
+    }
+
+    // backward-shift deletion: move every following record of the run that may occupy the
+    // freed slot, i.e., whose home slot is not cyclically within (i, j]
+    for (size_t j = (i + 1) & mask; m_slots[j] != NONE; j = (j + 1) & mask) {
+      size_t home = m_records[m_slots[j]].hash & mask;
+      if (((j - home) & mask) >= ((j - i) & mask)) {
+        m_slots[i] = m_slots[j];
+        i = j;
+      }
+    }
+    m_slots[i] = NONE;
+    --m_size;
+
+    if (record.isInExpiryList) {
+      this->removeFromExpiryList(index);
+    }
+    record.name = Name();
+    m_freeRecords.push_back(index);
+  }
+
+  /** \brief erase records from the head of the expiry list while isExpired(record) holds
+   *  \return number of erased records
+   */
+  template<typename F>
+  size_t
+  expire(const F& isExpired)
+  {
+    size_t nExpired = 0;
+    while (m_expiryHead != NONE && isExpired(m_records[m_expiryHead])) {
+      this->erase(m_records[m_expiryHead]);
+      ++nExpired;
+    }
+    return nExpired;
+  }
+
+private:
+  void
+  rehash(size_t newNSlots)
+  {
+    std::vector<uint32_t> oldSlots(newNSlots, NONE);
+    oldSlots.swap(m_slots);
+
+    // Records are reinserted in probe order, starting after an empty slot, so that a run that
+    // wraps past the end of the array keeps records with the same name in insertion order.
+    size_t oldMask = oldSlots.size() - 1;
+    size_t start = 0;
+    while (oldSlots[start] != NONE) {
+      ++start;
+    }
+
+    size_t mask = m_slots.size() - 1;
+    for (size_t k = 1; k <= oldSlots.size(); ++k) {
+      uint32_t index = oldSlots[(start + k) & oldMask];
+      if (index == NONE) {
+        continue;
+      }
+      size_t i = m_records[index].hash & mask;
+      while (m_slots[i] != NONE) {
+        i = (i + 1) & mask;
+      }
+      m_slots[i] = index;
+    }
+  }
+
+  void
+  appendToExpiryList(uint32_t index)
+  {
+    Record& record = m_records[index];
+    record.isInExpiryList = true;
+    record.expiryPrev = m_expiryTail;
+    record.expiryNext = NONE;
+
+    if (m_expiryTail != NONE) {
+      m_records[m_expiryTail].expiryNext = index;
+    }
+    else {
+      m_expiryHead = index;
+    }
+    m_expiryTail = index;
+  }
+
+  void
+  removeFromExpiryList(uint32_t index)
+  {
+    Record& record = m_records[index];
+    if (record.expiryPrev != NONE) {
+      m_records[record.expiryPrev].expiryNext = record.expiryNext;
+    }
+    else {
+      m_expiryHead = record.expiryNext;
+    }
+
+    if (record.expiryNext != NONE) {
+      m_records[record.expiryNext].expiryPrev = record.expiryPrev;
+    }
+    else {
+      m_expiryTail = record.expiryPrev;
+    }
+
+    record.isInExpiryList = false;
+    record.expiryPrev = record.expiryNext = NONE;
+  }
+
+private:
+  static constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+  static constexpr size_t INITIAL_N_SLOTS = 64; // must be a power of two
+
+  std::vector<Record> m_records;
+  std::vector<uint32_t> m_freeRecords;
+  std::vector<uint32_t> m_slots; ///< index into m_records, or NONE
+  size_t m_size = 0;
+
+  uint32_t m_expiryHead = NONE;
+  uint32_t m_expiryTail = NONE;
+};
+
+template<typename T>
+constexpr uint32_t SoftStateTable<T>::NONE;
+
+template<typename T>
+constexpr size_t SoftStateTable<T>::INITIAL_N_SLOTS;
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_SOFT_STATE_TABLE_HPP
@@ -39,6 +39,7 @@
 #include "ns3/data-rate.h"
 
 #include "daemon/mgmt/fib-manager.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
 #include "ns3/ndnSIM/model/ndn-l3-protocol.hpp"
 #include "ns3/ndnSIM/helper/ndn-stack-helper.hpp"
 
@@ -50,6 +51,16 @@ NS_LOG_COMPONENT_DEFINE("ndn.FibHelper");
 void
 FibHelper::AddNextHop(const ControlParameters& parameters, Ptr<Node> node)
 {
+  Ptr<L3Protocol> l3protocol = node->GetObject<L3Protocol>();
+  if (!l3protocol->isManagementEnabled()) {
+    nfd::Face* face = l3protocol->getFaceTable().get(parameters.getFaceId());
+    NS_ASSERT_MSG(face != nullptr, "Face with ID [" << parameters.getFaceId()
+                                   << "] does not exist on node [" << node->GetId() << "]");
+    nfd::Fib& fib = l3protocol->getForwarder()->getFib();
+    fib.addOrUpdateNextHop(*fib.insert(parameters.getName()).first, *face, parameters.getCost());
+    return;
+  }
+
   Block encodedParameters(parameters.wireEncode());
 
   Name commandName("/localhost/nfd/fib");
@@ -60,13 +71,23 @@ FibHelper::AddNextHop(const ControlParameters& parameters, Ptr<Node> node)
   command->setCanBePrefix(false);
   StackHelper::getKeyChain().sign(*command);
 
-  Ptr<L3Protocol> l3protocol = node->GetObject<L3Protocol>();
   l3protocol->injectInterest(*command);
 }
 
 void
 FibHelper::RemoveNextHop(const ControlParameters& parameters, Ptr<Node> node)
 {
+  Ptr<L3Protocol> l3protocol = node->GetObject<L3Protocol>();
+  if (!l3protocol->isManagementEnabled()) {
+    nfd::Face* face = l3protocol->getFaceTable().get(parameters.getFaceId());
+    nfd::Fib& fib = l3protocol->getForwarder()->getFib();
+    nfd::fib::Entry* entry = fib.findExactMatch(parameters.getName());
+    if (face != nullptr && entry != nullptr) {
+      fib.removeNextHop(*entry, *face);
+    }
+    return;
+  }
+
   Block encodedParameters(parameters.wireEncode());
 
   Name commandName("/localhost/nfd/fib");
@@ -77,7 +98,6 @@ FibHelper::RemoveNextHop(const ControlParameters& parameters, Ptr<Node> node)
   command->setCanBePrefix(false);
   StackHelper::getKeyChain().sign(*command);
 
-  Ptr<L3Protocol> l3protocol = node->GetObject<L3Protocol>();
   l3protocol->injectInterest(*command);
 }
 
@@ -169,6 +189,28 @@ FibHelper::AddRoute(const std::string& nodeName, const Name& prefix,
   AddRoute(node, prefix, otherNode, metric);
 }
 
+void
+FibHelper::AddRoutes(Ptr<Node> node, const std::vector<Route>& routes)
+{
+  Ptr<L3Protocol> ndn = node->GetObject<L3Protocol>();
+  NS_ASSERT_MSG(ndn != 0, "Ndn stack should be installed on the node");
+
+  std::map<Name, std::vector<std::pair<nfd::Face*, uint64_t>>> nextHops;
+  for (const Route& route : routes) {
+    NS_LOG_LOGIC("[" << node->GetId() << "]$ route add " << route.prefix << " via "
+                     << route.face->getLocalUri() << " metric " << route.metric);
+    NS_ASSERT_MSG(ndn->getFaceTable().get(route.face->getId()) == route.face.get(),
+                  "Face with ID [" << route.face->getId() << "] does not exist on node ["
+                                   << node->GetId() << "]");
+    nextHops[route.prefix].emplace_back(route.face.get(), route.metric);
+  }
+
+  nfd::Fib& fib = ndn->getForwarder()->getFib();
+  for (const auto& prefixAndNextHops : nextHops) {
+    fib.addOrUpdateNextHops(*fib.insert(prefixAndNextHops.first).first, prefixAndNextHops.second);
+  }
+}
+
 void
 FibHelper::RemoveRoute(Ptr<Node> node, const Name& prefix, shared_ptr<Face> face)
 {
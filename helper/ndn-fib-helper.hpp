@@ -43,6 +43,16 @@ using ::ndn::nfd::ControlParameters;
  */
 class FibHelper {
 public:
+  /**
+   * \brief Forwarding entry to be added with AddRoutes
+   */
+  struct Route
+  {
+    Name prefix;
+    shared_ptr<Face> face;
+    int32_t metric;
+  };
+
   /**
    * \brief Add forwarding entry to FIB
    *
@@ -100,6 +110,20 @@ public:
   AddRoute(const std::string& nodeName, const Name& prefix, const std::string& otherNodeName,
            int32_t metric);
 
+  /**
+   * \brief Add forwarding entries to FIB directly, without management commands
+   *
+   * The routes are grouped by prefix: each FIB entry is looked up once, its nexthops are
+   * sorted once, and strategies are notified of at most one new nexthop per entry.  This is
+   * much faster than AddRoute when installing many routes, e.g., computed by
+   * GlobalRoutingHelper.
+   *
+   * \param node   Node
+   * \param routes Forwarding entries; faces must belong to the node
+   */
+  static void
+  AddRoutes(Ptr<Node> node, const std::vector<Route>& routes);
+
   /**
    * \brief remove forwarding entry in FIB
    *
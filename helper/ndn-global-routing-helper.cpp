@@ -256,6 +256,7 @@ GlobalRoutingHelper::CalculateRoutes()
     shared_ptr<nfd::Forwarder> forwarder = L3protocol->getForwarder();
 
     NS_LOG_DEBUG("Reachability from Node: " << source->GetObject<Node>()->GetId());
+    std::vector<FibHelper::Route> routes;
     for (const auto& dist : distances) {
       if (dist.first == source)
         continue;
@@ -270,12 +271,13 @@ GlobalRoutingHelper::CalculateRoutes()
                          << " with distance " << std::get<1>(dist.second) << " with delay "
                          << std::get<2>(dist.second));
 
-            FibHelper::AddRoute(*node, *prefix, std::get<0>(dist.second),
-                                std::get<1>(dist.second));
+            routes.push_back({*prefix, std::get<0>(dist.second),
+                              static_cast<int32_t>(std::get<1>(dist.second))});
           }
         }
       }
     }
+    FibHelper::AddRoutes(*node, routes);
   }
 }
 
@@ -313,6 +315,8 @@ GlobalRoutingHelper::CalculateAllPossibleRoutes()
     Ptr<L3Protocol> l3 = source->GetObject<L3Protocol>();
     NS_ASSERT(l3 != 0);
 
+    std::vector<FibHelper::Route> routes;
+
     // remember interface statuses
     std::list<nfd::FaceId> faceIds;
     std::unordered_map<nfd::FaceId, uint16_t> originalMetrics;
@@ -368,8 +372,8 @@ GlobalRoutingHelper::CalculateAllPossibleRoutes()
               if (std::get<0>(dist.second)->getMetric() == std::numeric_limits<uint16_t>::max() - 1)
                 continue;
 
-              FibHelper::AddRoute(*node, *prefix, std::get<0>(dist.second),
-                                  std::get<1>(dist.second));
+              routes.push_back({*prefix, std::get<0>(dist.second),
+                                static_cast<int32_t>(std::get<1>(dist.second))});
             }
           }
         }
@@ -383,6 +387,8 @@ GlobalRoutingHelper::CalculateAllPossibleRoutes()
     for (auto& i : originalMetrics) {
       l3->getFaceTable().get(i.first)->setMetric(i.second);
     }
+
+    FibHelper::AddRoutes(*node, routes);
   }
 }
 
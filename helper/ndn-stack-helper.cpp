@@ -132,6 +132,37 @@ StackHelper::setPolicy(const std::string& policy)
   }
 }
 
+void
+StackHelper::setCsWireOnly(bool isWireOnly)
+{
+  m_isCsWireOnly = isWireOnly;
+}
+
+void
+StackHelper::setDeadNonceListFalsePositiveRate(double falsePositiveRate)
+{
+  m_dnlFalsePositiveRate = falsePositiveRate;
+}
+
+void
+StackHelper::setNameTreeOpenAddressing(bool isOpenAddressing)
+{
+  m_isNameTreeOpenAddressing = isOpenAddressing;
+}
+
+void
+StackHelper::setMinimalProfile(bool isMinimal)
+{
+  m_isMinimalProfile = isMinimal;
+}
+
+void
+StackHelper::setCompactLp(bool isCompact, const std::vector<Name>& nameContexts)
+{
+  m_isCompactLp = isCompact;
+  m_lpNameContexts = nameContexts;
+}
+
 void
 StackHelper::Install(const NodeContainer& c) const
 {
@@ -164,15 +195,37 @@ StackHelper::doInstall(Ptr<Node> node) const
   // async install to ensure proper context
   Ptr<L3Protocol> ndn = m_ndnFactory.Create<L3Protocol>();
 
-  if (m_isForwarderStatusManagerDisabled) {
-    ndn->getConfig().put("ndnSIM.disable_forwarder_status_manager", true);
+  if (m_isMinimalProfile) {
+    L3Protocol::MinimalProfile profile;
+    profile.csMaxPackets = m_maxCsSize;
+    profile.isCsWireOnly = m_isCsWireOnly;
+    profile.dnlFalsePositiveRate = m_dnlFalsePositiveRate;
+    profile.isNameTreeOpenAddressing = m_isNameTreeOpenAddressing;
+    ndn->setMinimalProfile(profile);
   }
+  else {
+    if (m_isForwarderStatusManagerDisabled) {
+      ndn->getConfig().put("ndnSIM.disable_forwarder_status_manager", true);
+    }
 
-  if (m_isStrategyChoiceManagerDisabled) {
-    ndn->getConfig().put("ndnSIM.disable_strategy_choice_manager", true);
-  }
+    if (m_isStrategyChoiceManagerDisabled) {
+      ndn->getConfig().put("ndnSIM.disable_strategy_choice_manager", true);
+    }
+
+    ndn->getConfig().put("tables.cs_max_packets", m_maxCsSize);
+
+    if (m_isCsWireOnly) {
+      ndn->getConfig().put("ndnSIM.cs_wire_only", true);
+    }
+
+    if (m_dnlFalsePositiveRate > 0.0) {
+      ndn->getConfig().put("ndnSIM.dnl_false_positive_rate", m_dnlFalsePositiveRate);
+    }
 
-  ndn->getConfig().put("tables.cs_max_packets", m_maxCsSize);
+    if (m_isNameTreeOpenAddressing) {
+      ndn->getConfig().put("ndnSIM.name_tree_open_addressing", true);
+    }
+  }
 
   ndn->setCsReplacementPolicy(m_csPolicyCreationFunc);
 
@@ -242,6 +295,11 @@ StackHelper::DefaultNetDeviceCallback(Ptr<Node> node, Ptr<L3Protocol> ndn,
   opts.allowFragmentation = true;
   opts.allowReassembly = true;
   opts.allowCongestionMarking = true;
+  if (m_isCompactLp) {
+    opts.allowCompactHeaders = true;
+    opts.fragmenterOptions.isOverheadBoundByMtu = true;
+    opts.nameContexts = m_lpNameContexts;
+  }
 
   auto linkService = make_unique<::nfd::face::GenericLinkService>(opts);
 
@@ -281,6 +339,11 @@ StackHelper::PointToPointNetDeviceCallback(Ptr<Node> node, Ptr<L3Protocol> ndn,
   opts.allowFragmentation = true;
   opts.allowReassembly = true;
   opts.allowCongestionMarking = true;
+  if (m_isCompactLp) {
+    opts.allowCompactHeaders = true;
+    opts.fragmenterOptions.isOverheadBoundByMtu = true;
+    opts.nameContexts = m_lpNameContexts;
+  }
 
   auto linkService = make_unique<::nfd::face::GenericLinkService>(opts);
 
@@ -406,6 +469,20 @@ StackHelper::SetLinkDelayAsFaceMetric()
   }
 }
 
+int64_t
+StackHelper::AssignStreams(const NodeContainer& c, int64_t stream)
+{
+  int64_t currentStream = stream;
+  for (NodeContainer::Iterator i = c.Begin(); i != c.End(); ++i) {
+    auto ndn = (*i)->GetObject<L3Protocol>();
+    if (ndn == nullptr)
+      continue;
+
+    currentStream += ndn->AssignStreams(currentStream);
+  }
+  return currentStream - stream;
+}
+
 void
 StackHelper::ProcessWarmupEvents()
 {
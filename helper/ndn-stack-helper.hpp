@@ -85,6 +85,53 @@ public:
   void
   setPolicy(const std::string& policy);
 
+  /**
+   * @brief Store only the wire encoding of Data packets in NFD's Content Store
+   *
+   * Reduces the memory held by cached packets, at the cost of decoding Data on every cache hit.
+   */
+  void
+  setCsWireOnly(bool isWireOnly);
+
+  /**
+   * @brief Store NFD's Dead Nonce List in a quotient filter with the given false positive rate
+   *
+   * A lower rate takes more memory; 0 (default) keeps the exact hashtable.
+   */
+  void
+  setDeadNonceListFalsePositiveRate(double falsePositiveRate);
+
+  /**
+   * @brief Use an open-addressing hashtable in NFD's NameTree
+   *
+   * Lookups read a dense array of slots instead of following a linked list of nodes per bucket.
+   */
+  void
+  setNameTreeOpenAddressing(bool isOpenAddressing);
+
+  /**
+   * @brief Install a minimal NFD on the nodes, without config parsing, management and RIB
+   *
+   * Meant for simulations with many nodes, where the per-node NFD management dominates startup
+   * time and memory.  FIB and strategy choice are still set with FibHelper and
+   * StrategyChoiceHelper, which update the tables directly.
+   *
+   * @sa L3Protocol::MinimalProfile
+   */
+  void
+  setMinimalProfile(bool isMinimal);
+
+  /**
+   * @brief Use compact NDNLPv2 headers on the faces created for net devices
+   *
+   * HopCount and GeoTag fields with a default value are omitted, fragments reserve only the
+   * overhead they can take within the device MTU, and Names that start with one of
+   * @p nameContexts are sent without that prefix.  Meant for small MTUs, e.g. LR-WPAN; all nodes
+   * sharing a link must use the same settings.
+   */
+  void
+  setCompactLp(bool isCompact, const std::vector<Name>& nameContexts = {});
+
   typedef Callback<shared_ptr<Face>, Ptr<Node>, Ptr<L3Protocol>, Ptr<NetDevice>>
     FaceCreateCallback;
 
@@ -227,6 +274,19 @@ public:
   static void
   SetLinkDelayAsFaceMetric();
 
+  /**
+   * @brief Assign fixed random variable streams to the forwarders installed on nodes in @p c
+   *        and to their strategies
+   *
+   * Call it after choosing the strategies with StrategyChoiceHelper.
+   *
+   * @param c NodeContainer of the nodes with installed NDN stack
+   * @param stream first stream index to use
+   * @return the number of stream indices assigned
+   */
+  static int64_t
+  AssignStreams(const NodeContainer& c, int64_t stream);
+
   static void
   ProcessWarmupEvents();
 
@@ -256,6 +316,12 @@ private:
 
   bool m_needSetDefaultRoutes;
   size_t m_maxCsSize = 100;
+  bool m_isCsWireOnly = false;
+  double m_dnlFalsePositiveRate = 0.0;
+  bool m_isNameTreeOpenAddressing = false;
+  bool m_isMinimalProfile = false;
+  bool m_isCompactLp = false;
+  std::vector<Name> m_lpNameContexts;
 
   typedef std::function<std::unique_ptr<nfd::cs::Policy>()> PolicyCreationCallback;
   PolicyCreationCallback m_csPolicyCreationFunc;
@@ -0,0 +1,72 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include <ns3/boolean.h>
+#include <ns3/command-line.h>
+#include <ns3/lr-wpan-error-model.h>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+using namespace ns3;
+
+//
+// Throughput of LrWpanErrorModel::GetChunkSuccessRate, analytic vs lookup table
+//
+// ./waf --run "lr-wpan-error-model-benchmark --evaluations=10000000"
+//
+static double
+Measure (Ptr<LrWpanErrorModel> model, uint32_t nEvaluations, double &checksum)
+{
+  auto before = std::chrono::steady_clock::now ();
+  for (uint32_t i = 0; i < nEvaluations; i++)
+    {
+      // SNR between -10 dB and 10 dB, chunks of 1 to 256 bits
+      double snr = pow (10.0, ((i % 2001) * 0.01 - 10.0) / 10.0);
+      checksum += model->GetChunkSuccessRate (snr, 1 + i % 256);
+    }
+  auto after = std::chrono::steady_clock::now ();
+  return std::chrono::duration<double> (after - before).count ();
+}
+
+int main (int argc, char *argv[])
+{
+  uint32_t nEvaluations = 10000000;
+
+  CommandLine cmd;
+  cmd.AddValue ("evaluations", "Number of GetChunkSuccessRate calls per model", nEvaluations);
+  cmd.Parse (argc, argv);
+
+  Ptr<LrWpanErrorModel> analytic = CreateObject<LrWpanErrorModel> ();
+  Ptr<LrWpanErrorModel> table = CreateObject<LrWpanErrorModel> ();
+  table->SetAttribute ("UseLookupTable", BooleanValue (true));
+
+  double analyticChecksum = 0;
+  double tableChecksum = 0;
+  table->GetChunkSuccessRate (1.0, 1); // build the table outside of the measurement
+
+  double analyticTime = Measure (analytic, nEvaluations, analyticChecksum);
+  double tableTime = Measure (table, nEvaluations, tableChecksum);
+
+  std::cout << "Evaluations" << "\t" << nEvaluations << std::endl
+            << "Analytic (ns/op)" << "\t" << analyticTime * 1e9 / nEvaluations << std::endl
+            << "Lookup table (ns/op)" << "\t" << tableTime * 1e9 / nEvaluations << std::endl
+            << "Speedup" << "\t" << analyticTime / tableTime << std::endl
+            << "Mean success rate, analytic" << "\t" << analyticChecksum / nEvaluations << std::endl
+            << "Mean success rate, lookup table" << "\t" << tableChecksum / nEvaluations << std::endl;
+
+  return 0;
+}
@@ -23,11 +23,13 @@
 #include <ns3/lr-wpan-csmaca.h>
 #include <ns3/lr-wpan-error-model.h>
 #include <ns3/lr-wpan-net-device.h>
+#include <ns3/lr-wpan-spectrum-channel.h>
 #include <ns3/mobility-model.h>
 #include <ns3/single-model-spectrum-channel.h>
 #include <ns3/multi-model-spectrum-channel.h>
 #include <ns3/propagation-loss-model.h>
 #include <ns3/propagation-delay-model.h>
+#include <ns3/double.h>
 #include <ns3/log.h>
 #include "ns3/names.h"
 
@@ -108,6 +110,7 @@ LrWpanHelper::EnableLogComponents (void)
   LogComponentEnable ("LrWpanMac", LOG_LEVEL_ALL);
   LogComponentEnable ("LrWpanNetDevice", LOG_LEVEL_ALL);
   LogComponentEnable ("LrWpanPhy", LOG_LEVEL_ALL);
+  LogComponentEnable ("LrWpanSpectrumChannel", LOG_LEVEL_ALL);
   LogComponentEnable ("LrWpanSpectrumSignalParameters", LOG_LEVEL_ALL);
   LogComponentEnable ("LrWpanSpectrumValueHelper", LOG_LEVEL_ALL);
 }
@@ -211,6 +214,21 @@ LrWpanHelper::SetChannel (std::string channelName)
   m_channel = channel;
 }
 
+void
+LrWpanHelper::EnableSpatialGrid (double rxPowerThresholdDbm)
+{
+  Ptr<LrWpanSpectrumChannel> channel = CreateObject<LrWpanSpectrumChannel> ();
+  channel->SetAttribute ("RxPowerThreshold", DoubleValue (rxPowerThresholdDbm));
+
+  Ptr<LogDistancePropagationLossModel> lossModel = CreateObject<LogDistancePropagationLossModel> ();
+  channel->AddPropagationLossModel (lossModel);
+
+  Ptr<ConstantSpeedPropagationDelayModel> delayModel = CreateObject<ConstantSpeedPropagationDelayModel> ();
+  channel->SetPropagationDelayModel (delayModel);
+
+  m_channel = channel;
+}
+
 
 int64_t
 LrWpanHelper::AssignStreams (NetDeviceContainer c, int64_t stream)
@@ -90,6 +90,20 @@ public:
    */
   void SetChannel (std::string channelName);
 
+  /**
+   * \brief Replace the channel associated to this helper by a
+   * LrWpanSpectrumChannel, with a LogDistancePropagationLossModel and a
+   * ConstantSpeedPropagationDelayModel.
+   *
+   * The LrWpanSpectrumChannel only delivers signals to the PHYs within reach
+   * of the transmitter, which scales better for large networks.  This has to
+   * be called before installing any devices.
+   *
+   * \param rxPowerThresholdDbm the power in dBm, below which signals are not
+   * delivered
+   */
+  void EnableSpatialGrid (double rxPowerThresholdDbm = -106.58);
+
   /**
    * \brief Add mobility model to a physical device
    * \param phy the physical device
@@ -19,7 +19,9 @@
  */
 #include "lr-wpan-error-model.h"
 #include <ns3/log.h>
+#include <ns3/boolean.h>
 
+#include <algorithm>
 #include <cmath>
 
 namespace ns3 {
@@ -28,6 +30,9 @@ NS_LOG_COMPONENT_DEFINE ("LrWpanErrorModel");
 
 NS_OBJECT_ENSURE_REGISTERED (LrWpanErrorModel);
 
+const double LrWpanErrorModel::LUT_MAX_SNR = 10.0;
+const uint32_t LrWpanErrorModel::LUT_STEPS = 10000;
+
 TypeId
 LrWpanErrorModel::GetTypeId (void)
 {
@@ -35,11 +40,18 @@ LrWpanErrorModel::GetTypeId (void)
     .SetParent<Object> ()
     .SetGroupName ("LrWpan")
     .AddConstructor<LrWpanErrorModel> ()
+    .AddAttribute ("UseLookupTable",
+                   "Interpolate the BER from a precomputed table instead of "
+                   "evaluating the analytic expression.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&LrWpanErrorModel::m_useLookupTable),
+                   MakeBooleanChecker ())
   ;
   return tid;
 }
 
 LrWpanErrorModel::LrWpanErrorModel (void)
+  : m_useLookupTable (false)
 {
   m_binomialCoefficients[0]  = 1;
   m_binomialCoefficients[1]  = -16;
@@ -61,7 +73,7 @@ LrWpanErrorModel::LrWpanErrorModel (void)
 }
 
 double
-LrWpanErrorModel::GetChunkSuccessRate (double snr, uint32_t nbits) const
+LrWpanErrorModel::ComputeBer (double snr) const
 {
   double ber = 0.0;
 
@@ -72,9 +84,45 @@ LrWpanErrorModel::GetChunkSuccessRate (double snr, uint32_t nbits) const
 
   ber = ber * 8.0 / 15.0 / 16.0;
 
-  ber = std::min (ber, 1.0);
-  double retval = pow (1.0 - ber, nbits);
-  return retval;
+  return std::min (ber, 1.0);
+}
+
+const std::vector<double>&
+LrWpanErrorModel::GetLogBerTable (void) const
+{
+  static const std::vector<double> table = [this] {
+    std::vector<double> logBer (LUT_STEPS + 1);
+    for (uint32_t i = 0; i <= LUT_STEPS; i++)
+      {
+        logBer[i] = log (ComputeBer (LUT_MAX_SNR * i / LUT_STEPS));
+      }
+    return logBer;
+  } ();
+  return table;
+}
+
+double
+LrWpanErrorModel::GetChunkSuccessRate (double snr, uint32_t nbits) const
+{
+  if (!m_useLookupTable)
+    {
+      double ber = ComputeBer (snr);
+      double retval = pow (1.0 - ber, nbits);
+      return retval;
+    }
+
+  if (snr >= LUT_MAX_SNR)
+    {
+      return 1.0;
+    }
+
+  const std::vector<double>& logBer = GetLogBerTable ();
+  double pos = std::max (snr, 0.0) * (LUT_STEPS / LUT_MAX_SNR);
+  uint32_t i = std::min (static_cast<uint32_t> (pos), LUT_STEPS - 1);
+  double frac = pos - i;
+  double ber = exp (logBer[i] + frac * (logBer[i + 1] - logBer[i]));
+
+  return exp (nbits * log1p (-ber));
 }
 
 } // namespace ns3
@@ -22,6 +22,8 @@
 
 #include <ns3/object.h>
 
+#include <vector>
+
 namespace ns3 {
 
 /**
@@ -30,6 +32,11 @@ namespace ns3 {
  * Model the error rate for IEEE 802.15.4 2.4 GHz AWGN channel for OQPSK
  * the model description can be found in IEEE Std 802.15.4-2006, section
  * E.4.1.7
+ *
+ * With the UseLookupTable attribute set, the BER is interpolated from a table
+ * of the analytic BER over a fine SNR grid instead of being evaluated, and the
+ * chunk success rate is computed as exp (nbits * log1p (-BER)).  The table is
+ * computed once and shared by all instances.
  */
 class LrWpanErrorModel : public Object
 {
@@ -53,6 +60,38 @@ public:
   double GetChunkSuccessRate (double snr, uint32_t nbits) const;
 
 private:
+  /**
+   * Evaluate the analytic bit error rate for given SNR.
+   *
+   * \return bit error rate
+   * \param snr SNR expressed as a power ratio (i.e. not in dB)
+   */
+  double ComputeBer (double snr) const;
+
+  /**
+   * Get the table of ln (BER) over LUT_STEPS equal steps of SNR between 0
+   * and LUT_MAX_SNR, computing it on first use.
+   *
+   * \return the table
+   */
+  const std::vector<double>& GetLogBerTable (void) const;
+
+  /**
+   * SNR (as a power ratio) above which the BER is below 1e-43, i.e., the
+   * chunk success rate is 1 in double precision.
+   */
+  static const double LUT_MAX_SNR;
+
+  /**
+   * Number of SNR steps of the lookup table.
+   */
+  static const uint32_t LUT_STEPS;
+
+  /**
+   * Use the lookup table instead of evaluating the analytic BER.
+   */
+  bool m_useLookupTable;
+
   /**
    * Array of precalculated binomial coefficients.
    */
@@ -22,6 +22,7 @@
 #include <ns3/spectrum-value.h>
 #include <ns3/spectrum-model.h>
 #include <ns3/log.h>
+#include <algorithm>
 
 namespace ns3 {
 
@@ -29,7 +30,9 @@ NS_LOG_COMPONENT_DEFINE ("LrWpanInterferenceHelper");
 
 LrWpanInterferenceHelper::LrWpanInterferenceHelper (Ptr<const SpectrumModel> spectrumModel)
   : m_spectrumModel (spectrumModel),
-    m_dirty (false)
+    m_dirty (false),
+    m_inBandChannel (0),
+    m_nRemovedSinceResum (0)
 {
   m_signal = Create<SpectrumValue> (m_spectrumModel);
 }
@@ -51,9 +54,19 @@ LrWpanInterferenceHelper::AddSignal (Ptr<const SpectrumValue> signal)
   if (signal->GetSpectrumModel () == m_spectrumModel)
     {
       result = m_signals.insert (signal).second;
-      if (result && !m_dirty)
+      if (result)
         {
-          *m_signal += *signal;
+          // The complete PSD is only summed up on demand in GetSignalPsd.
+          m_dirty = true;
+
+          if (m_inBandChannel != 0)
+            {
+              uint32_t firstBin = LrWpanSpectrumValueHelper::GetFirstInBandBin (m_inBandChannel);
+              for (uint32_t i = 0; i < LrWpanSpectrumValueHelper::IN_BAND_BINS; i++)
+                {
+                  m_inBandPsd[i] += (*signal)[firstBin + i];
+                }
+            }
         }
     }
   return result;
@@ -72,6 +85,25 @@ LrWpanInterferenceHelper::RemoveSignal (Ptr<const SpectrumValue> signal)
       if (result)
         {
           m_dirty = true;
+
+          if (m_signals.empty ())
+            {
+              // Nothing to accumulate, start over without rounding errors.
+              std::fill (m_inBandPsd, m_inBandPsd + LrWpanSpectrumValueHelper::IN_BAND_BINS, 0.0);
+              m_nRemovedSinceResum = 0;
+            }
+          else if (++m_nRemovedSinceResum >= RESUM_INTERVAL)
+            {
+              m_inBandChannel = 0;
+            }
+          else if (m_inBandChannel != 0)
+            {
+              uint32_t firstBin = LrWpanSpectrumValueHelper::GetFirstInBandBin (m_inBandChannel);
+              for (uint32_t i = 0; i < LrWpanSpectrumValueHelper::IN_BAND_BINS; i++)
+                {
+                  m_inBandPsd[i] -= (*signal)[firstBin + i];
+                }
+            }
         }
     }
   return result;
@@ -84,6 +116,9 @@ LrWpanInterferenceHelper::ClearSignals (void)
 
   m_signals.clear ();
   m_dirty = true;
+
+  std::fill (m_inBandPsd, m_inBandPsd + LrWpanSpectrumValueHelper::IN_BAND_BINS, 0.0);
+  m_nRemovedSinceResum = 0;
 }
 
 Ptr<SpectrumValue>
@@ -106,4 +141,45 @@ LrWpanInterferenceHelper::GetSignalPsd (void) const
   return m_signal->Copy ();
 }
 
+double
+LrWpanInterferenceHelper::GetSignalPower (uint32_t channel) const
+{
+  NS_LOG_FUNCTION (this << channel);
+
+  if (m_inBandChannel != channel)
+    {
+      ResumInBandPower (channel);
+    }
+
+  double totalAvgPower = 0.0;
+  for (uint32_t i = 0; i < LrWpanSpectrumValueHelper::IN_BAND_BINS; i++)
+    {
+      totalAvgPower += m_inBandPsd[i];
+    }
+  totalAvgPower *= 1.0e6;
+
+  return totalAvgPower;
+}
+
+void
+LrWpanInterferenceHelper::ResumInBandPower (uint32_t channel) const
+{
+  NS_LOG_FUNCTION (this << channel);
+
+  std::fill (m_inBandPsd, m_inBandPsd + LrWpanSpectrumValueHelper::IN_BAND_BINS, 0.0);
+
+  uint32_t firstBin = LrWpanSpectrumValueHelper::GetFirstInBandBin (channel);
+  std::set<Ptr<const SpectrumValue> >::const_iterator it;
+  for (it = m_signals.begin (); it != m_signals.end (); ++it)
+    {
+      for (uint32_t i = 0; i < LrWpanSpectrumValueHelper::IN_BAND_BINS; i++)
+        {
+          m_inBandPsd[i] += (*(*it))[firstBin + i];
+        }
+    }
+
+  m_inBandChannel = channel;
+  m_nRemovedSinceResum = 0;
+}
+
 }
@@ -21,6 +21,7 @@
 #ifndef LR_WPAN_INTERFERENCE_HELPER_H
 #define LR_WPAN_INTERFERENCE_HELPER_H
 
+#include "lr-wpan-spectrum-value-helper.h"
 #include <ns3/simple-ref-count.h>
 #include <ns3/ptr.h>
 #include <set>
@@ -34,6 +35,14 @@ class SpectrumModel;
  * \ingroup lr-wpan
  *
  * \brief This class provides helper functions for LrWpan interference handling.
+ *
+ * Besides the sum of all accumulated signals, the helper keeps a running sum
+ * of the in-band bins of one channel, which is updated on every added or
+ * removed signal.  GetSignalPower uses this sum, so that the total power of
+ * the accumulated signals can be obtained without summing up and copying
+ * whole SpectrumValues.  The running sum is recomputed from the accumulated
+ * signals every RESUM_INTERVAL removals, to bound the rounding error of the
+ * subtractions.
  */
 class LrWpanInterferenceHelper : public SimpleRefCount<LrWpanInterferenceHelper>
 {
@@ -79,6 +88,15 @@ public:
    */
   Ptr<SpectrumValue> GetSignalPsd (void) const;
 
+  /**
+   * Get the total average power of all accumulated signals in the given
+   * channel, i.e. LrWpanSpectrumValueHelper::TotalAvgPower (GetSignalPsd (), channel).
+   *
+   * \param channel the channel number per IEEE802.15.4
+   * \return the total average power of the signals
+   */
+  double GetSignalPower (uint32_t channel) const;
+
   /**
    * Get the SpectrumModel used by the helper.
    *
@@ -96,6 +114,20 @@ private:
    * \returns
    */
   LrWpanInterferenceHelper& operator= (LrWpanInterferenceHelper const &);
+
+  /**
+   * Recompute the in-band running sum for the given channel from the set of
+   * accumulated signals.
+   *
+   * \param channel the channel number per IEEE802.15.4
+   */
+  void ResumInBandPower (uint32_t channel) const;
+
+  /**
+   * The number of removals after which the in-band running sum is recomputed.
+   */
+  static const uint32_t RESUM_INTERVAL = 64;
+
   /**
    * The helpers SpectrumModel.
    */
@@ -116,6 +148,23 @@ private:
    * to be recomputed before next use.
    */
   mutable bool m_dirty;
+
+  /**
+   * The running sum of the in-band bins of all accumulated signals, for
+   * channel m_inBandChannel.
+   */
+  mutable double m_inBandPsd[LrWpanSpectrumValueHelper::IN_BAND_BINS];
+
+  /**
+   * The channel of m_inBandPsd, 0 if m_inBandPsd has to be recomputed before
+   * next use.
+   */
+  mutable uint32_t m_inBandChannel;
+
+  /**
+   * The number of signals removed since m_inBandPsd was last recomputed.
+   */
+  mutable uint32_t m_nRemovedSinceResum;
 };
 
 }
@@ -284,7 +284,7 @@ LrWpanPhy::StartRx (Ptr<SpectrumSignalParameters> spectrumRxParams)
     {
       // Update the average receive power during ED.
       Time now = Simulator::Now ();
-      m_edPower.averagePower += LrWpanSpectrumValueHelper::TotalAvgPower (m_signal->GetSignalPsd (), m_phyPIBAttributes.phyCurrentChannel) * (now - m_edPower.lastUpdate).GetTimeStep () / m_edPower.measurementLength.GetTimeStep ();
+      m_edPower.averagePower += m_signal->GetSignalPower (m_phyPIBAttributes.phyCurrentChannel) * (now - m_edPower.lastUpdate).GetTimeStep () / m_edPower.measurementLength.GetTimeStep ();
       m_edPower.lastUpdate = now;
     }
 
@@ -298,7 +298,7 @@ LrWpanPhy::StartRx (Ptr<SpectrumSignalParameters> spectrumRxParams)
       // Update peak power if CCA is in progress.
       if (!m_ccaRequest.IsExpired ())
         {
-          double power = LrWpanSpectrumValueHelper::TotalAvgPower (m_signal->GetSignalPsd (), m_phyPIBAttributes.phyCurrentChannel);
+          double power = m_signal->GetSignalPower (m_phyPIBAttributes.phyCurrentChannel);
           if (m_ccaPeakPower < power)
             {
               m_ccaPeakPower = power;
@@ -333,10 +333,9 @@ LrWpanPhy::StartRx (Ptr<SpectrumSignalParameters> spectrumRxParams)
       // SINR.
       NS_LOG_DEBUG (this << " receiving packet with power: " << 10 * log10(LrWpanSpectrumValueHelper::TotalAvgPower (lrWpanRxParams->psd, m_phyPIBAttributes.phyCurrentChannel)) + 30 << "dBm");
       m_signal->AddSignal (lrWpanRxParams->psd);
-      Ptr<SpectrumValue> interferenceAndNoise = m_signal->GetSignalPsd ();
-      *interferenceAndNoise -= *lrWpanRxParams->psd;
-      *interferenceAndNoise += *m_noise;
-      double sinr = LrWpanSpectrumValueHelper::TotalAvgPower (lrWpanRxParams->psd, m_phyPIBAttributes.phyCurrentChannel) / LrWpanSpectrumValueHelper::TotalAvgPower (interferenceAndNoise, m_phyPIBAttributes.phyCurrentChannel);
+      double signalPower = LrWpanSpectrumValueHelper::TotalAvgPower (lrWpanRxParams->psd, m_phyPIBAttributes.phyCurrentChannel);
+      double interferenceAndNoise = m_signal->GetSignalPower (m_phyPIBAttributes.phyCurrentChannel) - signalPower + LrWpanSpectrumValueHelper::TotalAvgPower (m_noise, m_phyPIBAttributes.phyCurrentChannel);
+      double sinr = signalPower / interferenceAndNoise;
 
       // Std. 802.15.4-2006, appendix E, Figure E.2
       // At SNR < -5 the BER is less than 10e-1.
@@ -381,7 +380,7 @@ LrWpanPhy::StartRx (Ptr<SpectrumSignalParameters> spectrumRxParams)
   // Update peak power if CCA is in progress.
   if (!m_ccaRequest.IsExpired ())
     {
-      double power = LrWpanSpectrumValueHelper::TotalAvgPower (m_signal->GetSignalPsd (), m_phyPIBAttributes.phyCurrentChannel);
+      double power = m_signal->GetSignalPower (m_phyPIBAttributes.phyCurrentChannel);
       if (m_ccaPeakPower < power)
         {
           m_ccaPeakPower = power;
@@ -412,10 +411,9 @@ LrWpanPhy::CheckInterference (void)
           // How many bits did we receive since the last calculation?
           double t = (Simulator::Now () - m_rxLastUpdate).ToDouble (Time::MS);
           uint32_t chunkSize = ceil (t * (GetDataOrSymbolRate (true) / 1000));
-          Ptr<SpectrumValue> interferenceAndNoise = m_signal->GetSignalPsd ();
-          *interferenceAndNoise -= *currentRxParams->psd;
-          *interferenceAndNoise += *m_noise;
-          double sinr = LrWpanSpectrumValueHelper::TotalAvgPower (currentRxParams->psd, m_phyPIBAttributes.phyCurrentChannel) / LrWpanSpectrumValueHelper::TotalAvgPower (interferenceAndNoise, m_phyPIBAttributes.phyCurrentChannel);
+          double signalPower = LrWpanSpectrumValueHelper::TotalAvgPower (currentRxParams->psd, m_phyPIBAttributes.phyCurrentChannel);
+          double interferenceAndNoise = m_signal->GetSignalPower (m_phyPIBAttributes.phyCurrentChannel) - signalPower + LrWpanSpectrumValueHelper::TotalAvgPower (m_noise, m_phyPIBAttributes.phyCurrentChannel);
+          double sinr = signalPower / interferenceAndNoise;
           double per = 1.0 - m_errorModel->GetChunkSuccessRate (sinr, chunkSize);
 
           // The LQI is the total packet success rate scaled to 0-255.
@@ -451,7 +449,7 @@ LrWpanPhy::EndRx (Ptr<SpectrumSignalParameters> par)
     {
       // Update the average receive power during ED.
       Time now = Simulator::Now ();
-      m_edPower.averagePower += LrWpanSpectrumValueHelper::TotalAvgPower (m_signal->GetSignalPsd (), m_phyPIBAttributes.phyCurrentChannel) * (now - m_edPower.lastUpdate).GetTimeStep () / m_edPower.measurementLength.GetTimeStep ();
+      m_edPower.averagePower += m_signal->GetSignalPower (m_phyPIBAttributes.phyCurrentChannel) * (now - m_edPower.lastUpdate).GetTimeStep () / m_edPower.measurementLength.GetTimeStep ();
       m_edPower.lastUpdate = now;
     }
 
@@ -1081,7 +1079,7 @@ LrWpanPhy::EndEd (void)
 {
   NS_LOG_FUNCTION (this);
 
-  m_edPower.averagePower += LrWpanSpectrumValueHelper::TotalAvgPower (m_signal->GetSignalPsd (), m_phyPIBAttributes.phyCurrentChannel) * (Simulator::Now () - m_edPower.lastUpdate).GetTimeStep () / m_edPower.measurementLength.GetTimeStep ();
+  m_edPower.averagePower += m_signal->GetSignalPower (m_phyPIBAttributes.phyCurrentChannel) * (Simulator::Now () - m_edPower.lastUpdate).GetTimeStep () / m_edPower.measurementLength.GetTimeStep ();
 
   uint8_t energyLevel;
 
@@ -1115,7 +1113,7 @@ LrWpanPhy::EndCca (void)
   LrWpanPhyEnumeration sensedChannelState = IEEE_802_15_4_PHY_UNSPECIFIED;
 
   // Update peak power.
-  double power = LrWpanSpectrumValueHelper::TotalAvgPower (m_signal->GetSignalPsd (), m_phyPIBAttributes.phyCurrentChannel);
+  double power = m_signal->GetSignalPower (m_phyPIBAttributes.phyCurrentChannel);
   if (m_ccaPeakPower < power)
     {
       m_ccaPeakPower = power;
@@ -0,0 +1,482 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "lr-wpan-spectrum-channel.h"
+#include <ns3/spectrum-phy.h>
+#include <ns3/spectrum-value.h>
+#include <ns3/spectrum-propagation-loss-model.h>
+#include <ns3/propagation-loss-model.h>
+#include <ns3/propagation-delay-model.h>
+#include <ns3/constant-position-mobility-model.h>
+#include <ns3/antenna-model.h>
+#include <ns3/angles.h>
+#include <ns3/net-device.h>
+#include <ns3/node.h>
+#include <ns3/double.h>
+#include <ns3/simulator.h>
+#include <ns3/log.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("LrWpanSpectrumChannel");
+
+NS_OBJECT_ENSURE_REGISTERED (LrWpanSpectrumChannel);
+
+/**
+ * The distance in m, beyond which the radius is considered to be unlimited.
+ */
+static const double MAX_RADIUS = 1e7;
+
+/**
+ * The smallest edge length of the grid cells in m, so that the cells searched
+ * within MAX_RADIUS of a sender stay countable.
+ */
+static const double MIN_CELL_SIZE = 1.0;
+
+/**
+ * The largest absolute cell index. Coordinates further away share the cells at
+ * the edge of the grid, so that the indices and the searched range around them
+ * (at most MAX_RADIUS / MIN_CELL_SIZE cells) never overflow an int32_t.
+ */
+static const double MAX_CELL_INDEX = 1 << 30;
+
+TypeId
+LrWpanSpectrumChannel::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::LrWpanSpectrumChannel")
+    .SetParent<SpectrumChannel> ()
+    .SetGroupName ("LrWpan")
+    .AddConstructor<LrWpanSpectrumChannel> ()
+    .AddAttribute ("RxPowerThreshold",
+                   "Signals arriving with a lower power (in dBm) are not delivered. "
+                   "The default is the default receiver sensitivity of LrWpanPhy.",
+                   DoubleValue (-106.58),
+                   MakeDoubleAccessor (&LrWpanSpectrumChannel::m_rxPowerThresholdDbm),
+                   MakeDoubleChecker<double> ())
+    .AddAttribute ("CellSize",
+                   "The edge length of the grid cells (in m), "
+                   "0 to use the radius of the first transmission. "
+                   "Cells are at least 1 m wide.",
+                   DoubleValue (0.0),
+                   MakeDoubleAccessor (&LrWpanSpectrumChannel::m_cellSize),
+                   MakeDoubleChecker<double> (0.0))
+  ;
+  return tid;
+}
+
+LrWpanSpectrumChannel::LrWpanSpectrumChannel (void)
+  : m_cellSize (0.0),
+    m_rxPowerThresholdDbm (-106.58)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+LrWpanSpectrumChannel::~LrWpanSpectrumChannel (void)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+LrWpanSpectrumChannel::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  for (uint32_t i = 0; i < m_receivers.size (); i++)
+    {
+      if (m_receivers[i].isPlaced)
+        {
+          m_receivers[i].mobility->TraceDisconnectWithoutContext ("CourseChange",
+                                                                  MakeBoundCallback (&LrWpanSpectrumChannel::CourseChanged, this, i));
+        }
+    }
+  m_receivers.clear ();
+  m_unplaced.clear ();
+  m_moving.clear ();
+  m_cells.clear ();
+  m_radii.clear ();
+  m_spectrumModel = 0;
+  SpectrumChannel::DoDispose ();
+}
+
+void
+LrWpanSpectrumChannel::AddRx (Ptr<SpectrumPhy> phy)
+{
+  NS_LOG_FUNCTION (this << phy);
+
+  Receiver receiver;
+  receiver.phy = phy;
+  receiver.isPlaced = false;
+  receiver.isMoving = false;
+  receiver.x = 0;
+  receiver.y = 0;
+
+  // The mobility model is usually not known yet, PHYs are put into the grid
+  // on the next transmission.
+  m_unplaced.push_back (m_receivers.size ());
+  m_receivers.push_back (receiver);
+}
+
+std::size_t
+LrWpanSpectrumChannel::GetNDevices (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_receivers.size ();
+}
+
+Ptr<NetDevice>
+LrWpanSpectrumChannel::GetDevice (std::size_t i) const
+{
+  NS_LOG_FUNCTION (this << i);
+  return m_receivers.at (i).phy->GetDevice ();
+}
+
+double
+LrWpanSpectrumChannel::GetRadius (double txPowerDbm)
+{
+  NS_LOG_FUNCTION (this << txPowerDbm);
+
+  if (m_propagationLoss == 0)
+    {
+      return std::numeric_limits<double>::infinity ();
+    }
+
+  std::map<double, double>::const_iterator it = m_radii.find (txPowerDbm);
+  if (it != m_radii.end ())
+    {
+      return it->second;
+    }
+
+  Ptr<MobilityModel> a = CreateObject<ConstantPositionMobilityModel> ();
+  Ptr<MobilityModel> b = CreateObject<ConstantPositionMobilityModel> ();
+  a->SetPosition (Vector (0.0, 0.0, 0.0));
+
+  // Find a distance, at which the signal is below the threshold, and narrow
+  // down the radius from there.
+  double inRange = 0.0;
+  double outOfRange = 1.0;
+  b->SetPosition (Vector (outOfRange, 0.0, 0.0));
+  while (m_propagationLoss->CalcRxPower (txPowerDbm, a, b) >= m_rxPowerThresholdDbm)
+    {
+      inRange = outOfRange;
+      outOfRange *= 2;
+      if (outOfRange > MAX_RADIUS)
+        {
+          NS_LOG_WARN ("No finite radius for a transmit power of " << txPowerDbm << " dBm");
+          outOfRange = std::numeric_limits<double>::infinity ();
+          break;
+        }
+      b->SetPosition (Vector (outOfRange, 0.0, 0.0));
+    }
+  if (!std::isinf (outOfRange))
+    {
+      for (uint32_t i = 0; i < 64 && outOfRange - inRange > 1e-6 * outOfRange; i++)
+        {
+          double distance = (inRange + outOfRange) / 2;
+          b->SetPosition (Vector (distance, 0.0, 0.0));
+          if (m_propagationLoss->CalcRxPower (txPowerDbm, a, b) >= m_rxPowerThresholdDbm)
+            {
+              inRange = distance;
+            }
+          else
+            {
+              outOfRange = distance;
+            }
+        }
+    }
+
+  NS_LOG_LOGIC ("radius for " << txPowerDbm << " dBm = " << outOfRange << " m");
+  m_radii[txPowerDbm] = outOfRange;
+  return outOfRange;
+}
+
+uint64_t
+LrWpanSpectrumChannel::GetCellKey (int32_t x, int32_t y)
+{
+  return (static_cast<uint64_t> (static_cast<uint32_t> (x)) << 32) | static_cast<uint32_t> (y);
+}
+
+int32_t
+LrWpanSpectrumChannel::GetCellIndex (double coordinate) const
+{
+  double index = std::floor (coordinate / m_cellSize);
+  if (!(index > -MAX_CELL_INDEX))
+    {
+      return static_cast<int32_t> (-MAX_CELL_INDEX);
+    }
+  if (index > MAX_CELL_INDEX)
+    {
+      return static_cast<int32_t> (MAX_CELL_INDEX);
+    }
+  return static_cast<int32_t> (index);
+}
+
+void
+LrWpanSpectrumChannel::PlaceReceivers (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  std::vector<uint32_t> unplaced;
+  for (std::vector<uint32_t>::const_iterator it = m_unplaced.begin (); it != m_unplaced.end (); ++it)
+    {
+      Receiver &receiver = m_receivers[*it];
+      receiver.mobility = receiver.phy->GetMobility ();
+      if (receiver.mobility == 0)
+        {
+          unplaced.push_back (*it);
+          continue;
+        }
+
+      Vector position = receiver.mobility->GetPosition ();
+      receiver.x = GetCellIndex (position.x);
+      receiver.y = GetCellIndex (position.y);
+      receiver.isPlaced = true;
+      m_cells[GetCellKey (receiver.x, receiver.y)].push_back (*it);
+      UpdateMoving (*it);
+
+      receiver.mobility->TraceConnectWithoutContext ("CourseChange",
+                                                     MakeBoundCallback (&LrWpanSpectrumChannel::CourseChanged, this, *it));
+    }
+  m_unplaced.swap (unplaced);
+}
+
+void
+LrWpanSpectrumChannel::CourseChanged (LrWpanSpectrumChannel *channel, uint32_t index,
+                                      Ptr<const MobilityModel> mobility)
+{
+  channel->UpdateCell (index);
+  channel->UpdateMoving (index);
+}
+
+void
+LrWpanSpectrumChannel::UpdateCell (uint32_t index)
+{
+  NS_LOG_FUNCTION (this << index);
+
+  Receiver &receiver = m_receivers[index];
+  Vector position = receiver.mobility->GetPosition ();
+  int32_t x = GetCellIndex (position.x);
+  int32_t y = GetCellIndex (position.y);
+  if (x == receiver.x && y == receiver.y)
+    {
+      return;
+    }
+
+  std::unordered_map<uint64_t, std::vector<uint32_t> >::iterator cell = m_cells.find (GetCellKey (receiver.x, receiver.y));
+  NS_ASSERT (cell != m_cells.end ());
+  std::vector<uint32_t>::iterator it = std::find (cell->second.begin (), cell->second.end (), index);
+  NS_ASSERT (it != cell->second.end ());
+  *it = cell->second.back ();
+  cell->second.pop_back ();
+  if (cell->second.empty ())
+    {
+      m_cells.erase (cell);
+    }
+
+  receiver.x = x;
+  receiver.y = y;
+  m_cells[GetCellKey (x, y)].push_back (index);
+}
+
+void
+LrWpanSpectrumChannel::UpdateMoving (uint32_t index)
+{
+  NS_LOG_FUNCTION (this << index);
+
+  Receiver &receiver = m_receivers[index];
+  Vector velocity = receiver.mobility->GetVelocity ();
+  bool isMoving = velocity.x != 0 || velocity.y != 0;
+  if (isMoving == receiver.isMoving)
+    {
+      return;
+    }
+
+  receiver.isMoving = isMoving;
+  if (isMoving)
+    {
+      m_moving.push_back (index);
+    }
+  else
+    {
+      std::vector<uint32_t>::iterator it = std::find (m_moving.begin (), m_moving.end (), index);
+      NS_ASSERT (it != m_moving.end ());
+      *it = m_moving.back ();
+      m_moving.pop_back ();
+    }
+}
+
+void
+LrWpanSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> txParams)
+{
+  NS_LOG_FUNCTION (this << txParams->psd << txParams->duration << txParams->txPhy);
+  NS_ASSERT_MSG (txParams->psd, "NULL txPsd");
+  NS_ASSERT_MSG (txParams->txPhy, "NULL txPhy");
+
+  // copy it since traced value cannot be const
+  Ptr<SpectrumSignalParameters> txParamsTrace = txParams->Copy ();
+  m_txSigParamsTrace (txParamsTrace);
+
+  if (m_spectrumModel == 0)
+    {
+      m_spectrumModel = txParams->psd->GetSpectrumModel ();
+    }
+  else
+    {
+      // all attached SpectrumPhy instances must use the same SpectrumModel
+      NS_ASSERT (*(txParams->psd->GetSpectrumModel ()) == *m_spectrumModel);
+    }
+
+  Ptr<MobilityModel> senderMobility = txParams->txPhy->GetMobility ();
+  double txPowerDbm = 10.0 * std::log10 (Integral (*txParams->psd)) + 30.0;
+  double radius = std::numeric_limits<double>::infinity ();
+  if (senderMobility != 0)
+    {
+      radius = GetRadius (txPowerDbm);
+    }
+
+  if (std::isinf (radius))
+    {
+      for (std::vector<Receiver>::const_iterator it = m_receivers.begin (); it != m_receivers.end (); ++it)
+        {
+          if (it->phy != txParams->txPhy)
+            {
+              Deliver (txParams, txPowerDbm, senderMobility, *it);
+            }
+        }
+      return;
+    }
+
+  if (m_cellSize == 0)
+    {
+      m_cellSize = radius;
+    }
+  m_cellSize = std::max (m_cellSize, MIN_CELL_SIZE);
+  PlaceReceivers ();
+
+  // PHYs with a non-zero velocity have moved since their last course change.
+  for (std::vector<uint32_t>::const_iterator it = m_moving.begin (); it != m_moving.end (); ++it)
+    {
+      UpdateCell (*it);
+    }
+
+  // PHYs without mobility model receive every signal.
+  std::vector<uint32_t> candidates (m_unplaced);
+
+  Vector position = senderMobility->GetPosition ();
+  int32_t span = static_cast<int32_t> (std::ceil (radius / m_cellSize));
+  int32_t x = GetCellIndex (position.x);
+  int32_t y = GetCellIndex (position.y);
+  for (int32_t i = x - span; i <= x + span; i++)
+    {
+      for (int32_t j = y - span; j <= y + span; j++)
+        {
+          std::unordered_map<uint64_t, std::vector<uint32_t> >::const_iterator cell = m_cells.find (GetCellKey (i, j));
+          if (cell == m_cells.end ())
+            {
+              continue;
+            }
+          for (std::vector<uint32_t>::const_iterator it = cell->second.begin (); it != cell->second.end (); ++it)
+            {
+              if (CalculateDistance (position, m_receivers[*it].mobility->GetPosition ()) <= radius)
+                {
+                  candidates.push_back (*it);
+                }
+            }
+        }
+    }
+
+  // Schedule the receptions in the order a SingleModelSpectrumChannel would.
+  std::sort (candidates.begin (), candidates.end ());
+  for (std::vector<uint32_t>::const_iterator it = candidates.begin (); it != candidates.end (); ++it)
+    {
+      if (m_receivers[*it].phy != txParams->txPhy)
+        {
+          Deliver (txParams, txPowerDbm, senderMobility, m_receivers[*it]);
+        }
+    }
+}
+
+void
+LrWpanSpectrumChannel::Deliver (Ptr<SpectrumSignalParameters> txParams, double txPowerDbm,
+                                Ptr<MobilityModel> senderMobility, const Receiver &receiver)
+{
+  NS_LOG_FUNCTION (this << txParams << txPowerDbm << receiver.phy);
+
+  Time delay = MicroSeconds (0);
+  Ptr<MobilityModel> receiverMobility = receiver.phy->GetMobility ();
+  Ptr<SpectrumSignalParameters> rxParams;
+
+  if (senderMobility && receiverMobility)
+    {
+      double pathLossDb = 0;
+      if (txParams->txAntenna != 0)
+        {
+          Angles txAngles (receiverMobility->GetPosition (), senderMobility->GetPosition ());
+          pathLossDb -= txParams->txAntenna->GetGainDb (txAngles);
+        }
+      Ptr<AntennaModel> rxAntenna = receiver.phy->GetRxAntenna ();
+      if (rxAntenna != 0)
+        {
+          Angles rxAngles (senderMobility->GetPosition (), receiverMobility->GetPosition ());
+          pathLossDb -= rxAntenna->GetGainDb (rxAngles);
+        }
+      if (m_propagationLoss)
+        {
+          pathLossDb -= m_propagationLoss->CalcRxPower (0, senderMobility, receiverMobility);
+        }
+      NS_LOG_LOGIC ("total pathLoss = " << pathLossDb << " dB");
+      m_pathLossTrace (txParams->txPhy, receiver.phy, pathLossDb);
+      if (pathLossDb > m_maxLossDb || txPowerDbm - pathLossDb < m_rxPowerThresholdDbm)
+        {
+          // beyond range
+          return;
+        }
+
+      rxParams = txParams->Copy ();
+      *(rxParams->psd) *= std::pow (10.0, (-pathLossDb) / 10.0);
+
+      if (m_spectrumPropagationLoss)
+        {
+          rxParams->psd = m_spectrumPropagationLoss->CalcRxPowerSpectralDensity (rxParams->psd, senderMobility, receiverMobility);
+        }
+
+      if (m_propagationDelay)
+        {
+          delay = m_propagationDelay->GetDelay (senderMobility, receiverMobility);
+        }
+    }
+  else
+    {
+      rxParams = txParams->Copy ();
+    }
+
+  Ptr<NetDevice> netDev = receiver.phy->GetDevice ();
+  uint32_t dstNode = 0xffffffff;
+  if (netDev != 0)
+    {
+      dstNode = netDev->GetNode ()->GetId ();
+    }
+  Simulator::ScheduleWithContext (dstNode, delay, &LrWpanSpectrumChannel::StartRx, this, rxParams, receiver.phy);
+}
+
+void
+LrWpanSpectrumChannel::StartRx (Ptr<SpectrumSignalParameters> params, Ptr<SpectrumPhy> receiver)
+{
+  NS_LOG_FUNCTION (this << params << receiver);
+  receiver->StartRx (params);
+}
+
+} // namespace ns3
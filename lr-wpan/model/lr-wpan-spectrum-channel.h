@@ -0,0 +1,212 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef LR_WPAN_SPECTRUM_CHANNEL_H
+#define LR_WPAN_SPECTRUM_CHANNEL_H
+
+#include <ns3/spectrum-channel.h>
+#include <ns3/mobility-model.h>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \ingroup lr-wpan
+ *
+ * \brief A SpectrumChannel for large LrWpan networks, which only delivers a
+ * signal to the PHYs within reach of the transmitter.
+ *
+ * The channel behaves like a SingleModelSpectrumChannel, except that signals
+ * arriving with a power below the RxPowerThreshold attribute are not
+ * delivered at all.  To avoid visiting every attached PHY on each
+ * transmission, the PHYs are kept in a uniform grid over their x/y positions,
+ * which is updated whenever a mobility model reports a course change.  Mobility
+ * models like ConstantVelocityMobilityModel move between course changes, so
+ * the PHYs with a non-zero velocity are moved to their current cell on every
+ * transmission.  Then only the cells within the radius at which the
+ * propagation loss model drops the signal below the threshold are visited.
+ *
+ * The radius is computed from the transmit power and the propagation loss
+ * model, which thus has to be deterministic and monotonically increasing
+ * with distance (e.g. LogDistancePropagationLossModel), and antenna gains
+ * must not be positive.  PHYs without a mobility model receive every signal,
+ * as they do on a SingleModelSpectrumChannel.
+ *
+ * As long as the threshold is not above the receiver sensitivity, receptions
+ * are the same as on a SingleModelSpectrumChannel; only signals too weak to
+ * be received are left out of the interference at the receivers.
+ */
+class LrWpanSpectrumChannel : public SpectrumChannel
+{
+public:
+  LrWpanSpectrumChannel (void);
+  virtual ~LrWpanSpectrumChannel (void);
+
+  /**
+   * Get the type ID.
+   *
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  // inherited from SpectrumChannel
+  virtual void AddRx (Ptr<SpectrumPhy> phy);
+  virtual void StartTx (Ptr<SpectrumSignalParameters> params);
+
+  // inherited from Channel
+  virtual std::size_t GetNDevices (void) const;
+  virtual Ptr<NetDevice> GetDevice (std::size_t i) const;
+
+  /**
+   * Get the distance beyond which a signal transmitted with the given power
+   * is received below the RxPowerThreshold.
+   *
+   * \param txPowerDbm the transmit power in dBm
+   * \return the radius in m, infinity if there is no propagation loss model
+   */
+  double GetRadius (double txPowerDbm);
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  /**
+   * A PHY attached to the channel.
+   */
+  struct Receiver
+  {
+    Ptr<SpectrumPhy> phy; //!< the PHY
+    Ptr<MobilityModel> mobility; //!< the mobility model tracked in the grid
+    bool isPlaced; //!< whether the PHY is in the grid
+    bool isMoving; //!< whether the PHY is in m_moving
+    int32_t x; //!< the x index of the grid cell
+    int32_t y; //!< the y index of the grid cell
+  };
+
+  /**
+   * Put all PHYs, which are not in the grid yet, into the grid, if they have
+   * a mobility model by now.
+   */
+  void PlaceReceivers (void);
+
+  /**
+   * Move a PHY to the cell of its current position.
+   *
+   * \param index the index of the PHY in m_receivers
+   */
+  void UpdateCell (uint32_t index);
+
+  /**
+   * Add a PHY to m_moving if its mobility model has a non-zero velocity in
+   * the x/y plane, remove it otherwise.
+   *
+   * \param index the index of the PHY in m_receivers
+   */
+  void UpdateMoving (uint32_t index);
+
+  /**
+   * Trace sink for the course change of the mobility model of a PHY.
+   *
+   * \param channel the channel
+   * \param index the index of the PHY in m_receivers
+   * \param mobility the mobility model
+   */
+  static void CourseChanged (LrWpanSpectrumChannel *channel, uint32_t index,
+                             Ptr<const MobilityModel> mobility);
+
+  /**
+   * Get the key of the grid cell with the given indices.
+   *
+   * \param x the x index of the cell
+   * \param y the y index of the cell
+   * \return the key in m_cells
+   */
+  static uint64_t GetCellKey (int32_t x, int32_t y);
+
+  /**
+   * Get the index of the grid cell containing the given coordinate.
+   *
+   * \param coordinate the x or y coordinate in m
+   * \return the x or y index of the cell, clamped to the edge of the grid
+   */
+  int32_t GetCellIndex (double coordinate) const;
+
+  /**
+   * Deliver the signal to a single PHY, if it arrives with sufficient power.
+   *
+   * \param txParams the parameters of the transmitted signal
+   * \param txPowerDbm the transmit power in dBm
+   * \param senderMobility the mobility model of the transmitter
+   * \param receiver the receiving PHY
+   */
+  void Deliver (Ptr<SpectrumSignalParameters> txParams, double txPowerDbm,
+                Ptr<MobilityModel> senderMobility, const Receiver &receiver);
+
+  /**
+   * Used internally to reschedule transmission after the propagation delay.
+   *
+   * \param params the parameters of the signal
+   * \param receiver the receiving PHY
+   */
+  void StartRx (Ptr<SpectrumSignalParameters> params, Ptr<SpectrumPhy> receiver);
+
+  /**
+   * The SpectrumModel of all PHYs attached to the channel.
+   */
+  Ptr<const SpectrumModel> m_spectrumModel;
+
+  /**
+   * The PHYs attached to the channel, in the order they were added.
+   */
+  std::vector<Receiver> m_receivers;
+
+  /**
+   * The indices of the PHYs, which are not in the grid.
+   */
+  std::vector<uint32_t> m_unplaced;
+
+  /**
+   * The indices of the PHYs in the grid, which moved with a non-zero velocity
+   * at their last course change.
+   */
+  std::vector<uint32_t> m_moving;
+
+  /**
+   * The grid cells, each holding the indices of the PHYs in it.
+   */
+  std::unordered_map<uint64_t, std::vector<uint32_t> > m_cells;
+
+  /**
+   * The edge length of the grid cells in m, 0 until it is taken from the
+   * radius of the first transmission, and at least MIN_CELL_SIZE from then on.
+   */
+  double m_cellSize;
+
+  /**
+   * The signal power in dBm, below which signals are not delivered.
+   */
+  double m_rxPowerThresholdDbm;
+
+  /**
+   * The radius for each transmit power used so far.
+   */
+  std::map<double, double> m_radii;
+};
+
+} // namespace ns3
+
+#endif /* LR_WPAN_SPECTRUM_CHANNEL_H */
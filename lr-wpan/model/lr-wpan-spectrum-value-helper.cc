@@ -133,14 +133,20 @@ LrWpanSpectrumValueHelper::TotalAvgPower (Ptr<const SpectrumValue> psd, uint32_t
 
   // numerically integrate to get area under psd using 1 MHz resolution
 
-  totalAvgPower += (*psd)[2405 + 5 * (channel - 11) - 2400 - 2];
-  totalAvgPower += (*psd)[2405 + 5 * (channel - 11) - 2400 - 1];
-  totalAvgPower += (*psd)[2405 + 5 * (channel - 11) - 2400];
-  totalAvgPower += (*psd)[2405 + 5 * (channel - 11) - 2400 + 1];
-  totalAvgPower += (*psd)[2405 + 5 * (channel - 11) - 2400 + 2];
+  uint32_t firstBin = GetFirstInBandBin (channel);
+  for (uint32_t i = firstBin; i < firstBin + IN_BAND_BINS; i++)
+    {
+      totalAvgPower += (*psd)[i];
+    }
   totalAvgPower *= 1.0e6;
 
   return totalAvgPower;
 }
 
+uint32_t
+LrWpanSpectrumValueHelper::GetFirstInBandBin (uint32_t channel)
+{
+  return 2405 + 5 * (channel - 11) - 2400 - 2;
+}
+
 } // namespace ns3
@@ -61,6 +61,19 @@ public:
    */
   static double TotalAvgPower (Ptr<const SpectrumValue> psd, uint32_t channel);
 
+  /**
+   * \brief index of the first of the IN_BAND_BINS consecutive 1 MHz bins that
+   * TotalAvgPower integrates for the given channel
+   * \param channel the channel number per IEEE802.15.4
+   * \return the index of the first in-band bin
+   */
+  static uint32_t GetFirstInBandBin (uint32_t channel);
+
+  /**
+   * The number of 1 MHz bins that TotalAvgPower integrates.
+   */
+  static const uint32_t IN_BAND_BINS = 5;
+
 private:
   /**
    * A scaling factor for the noise power.
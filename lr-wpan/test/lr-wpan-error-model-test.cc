@@ -31,6 +31,7 @@
 #include <ns3/single-model-spectrum-channel.h>
 #include <ns3/mac16-address.h>
 #include <ns3/constant-position-mobility-model.h>
+#include <ns3/boolean.h>
 #include "ns3/rng-seed-manager.h"
 
 using namespace ns3;
@@ -86,6 +87,22 @@ private:
   virtual void DoRun (void);
 };
 
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan Error model lookup table Test
+ */
+class LrWpanErrorModelLookupTableTestCase : public TestCase
+{
+public:
+  LrWpanErrorModelLookupTableTestCase ();
+  virtual ~LrWpanErrorModelLookupTableTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
 LrWpanErrorDistanceTestCase::LrWpanErrorDistanceTestCase ()
   : TestCase ("Test the 802.15.4 error model vs distance"),
     m_received (0)
@@ -198,6 +215,39 @@ LrWpanErrorModelTestCase::DoRun (void)
   NS_TEST_ASSERT_MSG_EQ_TOL (ber, 0.175, 0.001, "Model fails for SNR = " << snr);
 }
 
+// ==============================================================================
+LrWpanErrorModelLookupTableTestCase::LrWpanErrorModelLookupTableTestCase ()
+  : TestCase ("Test the 802.15.4 error model lookup table against the analytic model")
+{
+}
+
+LrWpanErrorModelLookupTableTestCase::~LrWpanErrorModelLookupTableTestCase ()
+{
+}
+
+void
+LrWpanErrorModelLookupTableTestCase::DoRun (void)
+{
+  Ptr<LrWpanErrorModel> analytic = CreateObject<LrWpanErrorModel> ();
+  Ptr<LrWpanErrorModel> table = CreateObject<LrWpanErrorModel> ();
+  table->SetAttribute ("UseLookupTable", BooleanValue (true));
+
+  for (double snr = -20; snr <= 15; snr += 0.01)
+    {
+      double snrRatio = pow (10.0, snr / 10.0);
+
+      // BER within 0.01% of the analytic one
+      double ber = 1.0 - analytic->GetChunkSuccessRate (snrRatio, 1);
+      double tableBer = -expm1 (log (table->GetChunkSuccessRate (snrRatio, 1)));
+      NS_TEST_ASSERT_MSG_EQ_TOL (tableBer, ber, 1e-4 * ber + 1e-15, "BER differs for SNR = " << snr);
+
+      // success rate of a maximum size PSDU
+      double csr = analytic->GetChunkSuccessRate (snrRatio, 127 * 8);
+      double tableCsr = table->GetChunkSuccessRate (snrRatio, 127 * 8);
+      NS_TEST_ASSERT_MSG_EQ_TOL (tableCsr, csr, 1e-6, "Chunk success rate differs for SNR = " << snr);
+    }
+}
+
 /**
  * \ingroup lr-wpan-test
  * \ingroup tests
@@ -215,6 +265,7 @@ LrWpanErrorModelTestSuite::LrWpanErrorModelTestSuite ()
 {
   AddTestCase (new LrWpanErrorModelTestCase, TestCase::QUICK);
   AddTestCase (new LrWpanErrorDistanceTestCase, TestCase::QUICK);
+  AddTestCase (new LrWpanErrorModelLookupTableTestCase, TestCase::QUICK);
 }
 
 static LrWpanErrorModelTestSuite g_lrWpanErrorModelTestSuite; //!< Static variable for test initialization
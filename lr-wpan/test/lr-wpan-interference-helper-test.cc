@@ -0,0 +1,133 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include <ns3/log.h>
+#include <ns3/test.h>
+#include <ns3/lr-wpan-interference-helper.h>
+#include <ns3/lr-wpan-spectrum-value-helper.h>
+#include <ns3/spectrum-value.h>
+
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief Test that the in-band running sum of LrWpanInterferenceHelper
+ * follows the sum of the accumulated signals
+ */
+class LrWpanInterferenceHelperTestCase : public TestCase
+{
+public:
+  LrWpanInterferenceHelperTestCase ();
+  virtual ~LrWpanInterferenceHelperTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * Check GetSignalPower against the total average power of GetSignalPsd.
+   *
+   * \param interference the helper to check
+   * \param channel the channel to check
+   * \param tolerance the absolute tolerance
+   */
+  void CheckPower (Ptr<LrWpanInterferenceHelper> interference, uint32_t channel, double tolerance);
+};
+
+LrWpanInterferenceHelperTestCase::LrWpanInterferenceHelperTestCase ()
+  : TestCase ("Test the running sum of the 802.15.4 interference helper")
+{
+}
+
+LrWpanInterferenceHelperTestCase::~LrWpanInterferenceHelperTestCase ()
+{
+}
+
+void
+LrWpanInterferenceHelperTestCase::CheckPower (Ptr<LrWpanInterferenceHelper> interference, uint32_t channel, double tolerance)
+{
+  double expected = LrWpanSpectrumValueHelper::TotalAvgPower (interference->GetSignalPsd (), channel);
+  NS_TEST_ASSERT_MSG_EQ_TOL (interference->GetSignalPower (channel), expected, tolerance, "Not equal for channel " << channel);
+}
+
+void
+LrWpanInterferenceHelperTestCase::DoRun (void)
+{
+  LrWpanSpectrumValueHelper psdHelper;
+  std::vector<Ptr<const SpectrumValue> > signals;
+  for (uint32_t i = 0; i < 200; i++)
+    {
+      // between -100 dBm and 0 dBm, on channels 11 to 13
+      double pwrdBm = -100.0 + (i * 37) % 101;
+      signals.push_back (psdHelper.CreateTxPowerSpectralDensity (pwrdBm, 11 + i % 3));
+    }
+  // the strongest signal is 0 dBm, i.e., 1 mW
+  double tolerance = 1.0e-3 * 1.0e-12;
+
+  Ptr<LrWpanInterferenceHelper> interference = Create<LrWpanInterferenceHelper> (signals[0]->GetSpectrumModel ());
+  NS_TEST_ASSERT_MSG_EQ (interference->GetSignalPower (11), 0.0, "No signal should have no power");
+
+  // add all, then remove in a different order with interleaved additions
+  for (uint32_t i = 0; i < signals.size (); i++)
+    {
+      interference->AddSignal (signals[i]);
+      CheckPower (interference, 11, tolerance);
+    }
+  for (uint32_t i = 0; i < signals.size (); i++)
+    {
+      interference->RemoveSignal (signals[(i * 7) % signals.size ()]);
+      CheckPower (interference, 11, tolerance);
+      if (i % 3 == 0)
+        {
+          interference->AddSignal (signals[(i * 7) % signals.size ()]);
+          CheckPower (interference, 11, tolerance);
+        }
+    }
+
+  // channel switch
+  CheckPower (interference, 12, tolerance);
+  CheckPower (interference, 13, tolerance);
+  CheckPower (interference, 11, tolerance);
+
+  interference->ClearSignals ();
+  NS_TEST_ASSERT_MSG_EQ (interference->GetSignalPower (11), 0.0, "Cleared helper should have no power");
+  interference->AddSignal (signals[5]);
+  CheckPower (interference, 11, tolerance);
+  interference->RemoveSignal (signals[5]);
+  NS_TEST_ASSERT_MSG_EQ (interference->GetSignalPower (11), 0.0, "Empty helper should have no power");
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan Interference Helper TestSuite
+ */
+class LrWpanInterferenceHelperTestSuite : public TestSuite
+{
+public:
+  LrWpanInterferenceHelperTestSuite ();
+};
+
+LrWpanInterferenceHelperTestSuite::LrWpanInterferenceHelperTestSuite ()
+  : TestSuite ("lr-wpan-interference-helper", UNIT)
+{
+  AddTestCase (new LrWpanInterferenceHelperTestCase, TestCase::QUICK);
+}
+
+static LrWpanInterferenceHelperTestSuite g_lrWpanInterferenceHelperTestSuite; //!< Static variable for test initialization
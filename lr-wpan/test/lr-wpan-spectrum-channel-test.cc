@@ -0,0 +1,314 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <ns3/test.h>
+#include <ns3/packet.h>
+#include <ns3/lr-wpan-module.h>
+#include <ns3/mobility-module.h>
+#include <ns3/propagation-module.h>
+#include <ns3/spectrum-module.h>
+#include <ns3/mac16-address.h>
+#include <ns3/log.h>
+
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("lr-wpan-spectrum-channel-test");
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan spatial grid channel Test
+ *
+ * A node broadcasts packets to nodes at increasing distances, once over a
+ * SingleModelSpectrumChannel and once over a LrWpanSpectrumChannel.  Then the
+ * farthest node is moved next to the sender and the broadcast is repeated.
+ * The number of packets received by every node must be the same on both
+ * channels.
+ */
+class LrWpanSpectrumChannelTestCase : public TestCase
+{
+public:
+  LrWpanSpectrumChannelTestCase ();
+  virtual ~LrWpanSpectrumChannelTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Run the scenario.
+   * \param useSpatialGrid use a LrWpanSpectrumChannel if true, a SingleModelSpectrumChannel otherwise
+   * \param rxPackets the number of packets received by every node
+   * \param nPathLosses the number of path loss computations of the channel
+   */
+  void RunScenario (bool useSpatialGrid, std::vector<uint32_t> &rxPackets, uint32_t &nPathLosses);
+};
+
+/**
+ * \brief Function called when DataIndication is hit.
+ * \param rxPackets the number of packets received by every node
+ * \param index the index of the receiving node
+ * \param params The MCPS params.
+ * \param p The packet.
+ */
+static void
+DataIndication (std::vector<uint32_t> *rxPackets, uint32_t index, McpsDataIndicationParams params, Ptr<Packet> p)
+{
+  (*rxPackets)[index]++;
+}
+
+/**
+ * \brief Function called when the channel computes a path loss.
+ * \param nPathLosses the number of path loss computations
+ * \param txPhy the transmitting PHY
+ * \param rxPhy the receiving PHY
+ * \param lossDb the path loss
+ */
+static void
+PathLoss (uint32_t *nPathLosses, Ptr<const SpectrumPhy> txPhy, Ptr<const SpectrumPhy> rxPhy, double lossDb)
+{
+  (*nPathLosses)++;
+}
+
+LrWpanSpectrumChannelTestCase::LrWpanSpectrumChannelTestCase ()
+  : TestCase ("Test the LrWpan spatial grid channel against the SingleModelSpectrumChannel")
+{
+}
+
+LrWpanSpectrumChannelTestCase::~LrWpanSpectrumChannelTestCase ()
+{
+}
+
+void
+LrWpanSpectrumChannelTestCase::RunScenario (bool useSpatialGrid, std::vector<uint32_t> &rxPackets, uint32_t &nPathLosses)
+{
+  NodeContainer nodes;
+  nodes.Create (10);
+
+  Ptr<ListPositionAllocator> positions = CreateObject<ListPositionAllocator> ();
+  positions->Add (Vector (0, 0, 0));
+  positions->Add (Vector (10, 0, 0));
+  positions->Add (Vector (0, 30, 0));
+  positions->Add (Vector (-60, 0, 0));
+  positions->Add (Vector (50, 50, 0));
+  positions->Add (Vector (0, -90, 0));
+  positions->Add (Vector (120, 0, 0));
+  positions->Add (Vector (-150, 150, 0));
+  positions->Add (Vector (300, 20, 0));
+  positions->Add (Vector (1000, 1000, 0));
+
+  MobilityHelper mobility;
+  mobility.SetPositionAllocator (positions);
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.Install (nodes);
+
+  LrWpanHelper lrWpanHelper;
+  if (useSpatialGrid)
+    {
+      lrWpanHelper.EnableSpatialGrid ();
+    }
+  NetDeviceContainer devices = lrWpanHelper.Install (nodes);
+  lrWpanHelper.AssociateToPan (devices, 0);
+  lrWpanHelper.AssignStreams (devices, 0);
+
+  lrWpanHelper.GetChannel ()->TraceConnectWithoutContext ("PathLoss", MakeBoundCallback (&PathLoss, &nPathLosses));
+
+  rxPackets.assign (nodes.GetN (), 0);
+  for (uint32_t i = 0; i < devices.GetN (); i++)
+    {
+      Ptr<LrWpanNetDevice> dev = DynamicCast<LrWpanNetDevice> (devices.Get (i));
+      dev->GetMac ()->SetMcpsDataIndicationCallback (MakeBoundCallback (&DataIndication, &rxPackets, i));
+    }
+
+  McpsDataRequestParams params;
+  params.m_srcAddrMode = SHORT_ADDR;
+  params.m_dstAddrMode = SHORT_ADDR;
+  params.m_dstPanId = 0;
+  params.m_dstAddr = Mac16Address ("ff:ff");
+  params.m_msduHandle = 0;
+
+  Ptr<LrWpanMac> sender = DynamicCast<LrWpanNetDevice> (devices.Get (0))->GetMac ();
+  for (uint32_t i = 0; i < 20; i++)
+    {
+      Simulator::Schedule (Seconds (1.0 + 0.1 * i), &LrWpanMac::McpsDataRequest, sender, params, Create<Packet> (20));
+    }
+
+  Ptr<MobilityModel> farNode = nodes.Get (nodes.GetN () - 1)->GetObject<MobilityModel> ();
+  Simulator::Schedule (Seconds (5.0), &MobilityModel::SetPosition, farNode, Vector (20, 20, 0));
+  for (uint32_t i = 0; i < 20; i++)
+    {
+      Simulator::Schedule (Seconds (6.0 + 0.1 * i), &LrWpanMac::McpsDataRequest, sender, params, Create<Packet> (20));
+    }
+
+  Simulator::Run ();
+  Simulator::Destroy ();
+}
+
+void
+LrWpanSpectrumChannelTestCase::DoRun (void)
+{
+  std::vector<uint32_t> singleModelRxPackets;
+  uint32_t singleModelPathLosses = 0;
+  RunScenario (false, singleModelRxPackets, singleModelPathLosses);
+
+  std::vector<uint32_t> spatialGridRxPackets;
+  uint32_t spatialGridPathLosses = 0;
+  RunScenario (true, spatialGridRxPackets, spatialGridPathLosses);
+
+  for (uint32_t i = 0; i < singleModelRxPackets.size (); i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (spatialGridRxPackets[i], singleModelRxPackets[i],
+                             "Node " << i << " should receive the same packets on both channels");
+    }
+  NS_TEST_ASSERT_MSG_EQ (spatialGridRxPackets[1], 40, "Nearby node should receive all packets");
+  NS_TEST_ASSERT_MSG_EQ (spatialGridRxPackets[8], 0, "Distant node should receive no packets");
+  NS_TEST_ASSERT_MSG_EQ (spatialGridRxPackets[9], 20, "Moved node should receive the packets sent after the move");
+  NS_TEST_ASSERT_MSG_LT (spatialGridPathLosses, singleModelPathLosses,
+                         "Distant nodes should not be visited by the spatial grid channel");
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan spatial grid channel Test with moving nodes
+ *
+ * A node broadcasts packets while another node drifts towards it, out of
+ * range and then into range, with a ConstantVelocityMobilityModel, which does
+ * not report a course change while it moves.  The number of packets received
+ * by every node must be the same on a SingleModelSpectrumChannel and on a
+ * LrWpanSpectrumChannel.
+ */
+class LrWpanSpectrumChannelMobilityTestCase : public TestCase
+{
+public:
+  LrWpanSpectrumChannelMobilityTestCase ();
+  virtual ~LrWpanSpectrumChannelMobilityTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Run the scenario.
+   * \param useSpatialGrid use a LrWpanSpectrumChannel if true, a SingleModelSpectrumChannel otherwise
+   * \param rxPackets the number of packets received by every node
+   */
+  void RunScenario (bool useSpatialGrid, std::vector<uint32_t> &rxPackets);
+};
+
+LrWpanSpectrumChannelMobilityTestCase::LrWpanSpectrumChannelMobilityTestCase ()
+  : TestCase ("Test the LrWpan spatial grid channel with a node moving at a constant velocity")
+{
+}
+
+LrWpanSpectrumChannelMobilityTestCase::~LrWpanSpectrumChannelMobilityTestCase ()
+{
+}
+
+void
+LrWpanSpectrumChannelMobilityTestCase::RunScenario (bool useSpatialGrid, std::vector<uint32_t> &rxPackets)
+{
+  NodeContainer nodes;
+  nodes.Create (3);
+
+  Ptr<ListPositionAllocator> positions = CreateObject<ListPositionAllocator> ();
+  positions->Add (Vector (0, 0, 0));
+  positions->Add (Vector (10, 0, 0));
+  positions->Add (Vector (400, 0, 0));
+
+  MobilityHelper mobility;
+  mobility.SetPositionAllocator (positions);
+  mobility.SetMobilityModel ("ns3::ConstantVelocityMobilityModel");
+  mobility.Install (nodes);
+
+  // The node crosses the radius of about 100 m at about 15 s.
+  nodes.Get (2)->GetObject<ConstantVelocityMobilityModel> ()->SetVelocity (Vector (-20, 0, 0));
+
+  LrWpanHelper lrWpanHelper;
+  if (useSpatialGrid)
+    {
+      lrWpanHelper.EnableSpatialGrid ();
+    }
+  NetDeviceContainer devices = lrWpanHelper.Install (nodes);
+  lrWpanHelper.AssociateToPan (devices, 0);
+  lrWpanHelper.AssignStreams (devices, 0);
+
+  rxPackets.assign (nodes.GetN (), 0);
+  for (uint32_t i = 0; i < devices.GetN (); i++)
+    {
+      Ptr<LrWpanNetDevice> dev = DynamicCast<LrWpanNetDevice> (devices.Get (i));
+      dev->GetMac ()->SetMcpsDataIndicationCallback (MakeBoundCallback (&DataIndication, &rxPackets, i));
+    }
+
+  McpsDataRequestParams params;
+  params.m_srcAddrMode = SHORT_ADDR;
+  params.m_dstAddrMode = SHORT_ADDR;
+  params.m_dstPanId = 0;
+  params.m_dstAddr = Mac16Address ("ff:ff");
+  params.m_msduHandle = 0;
+
+  Ptr<LrWpanMac> sender = DynamicCast<LrWpanNetDevice> (devices.Get (0))->GetMac ();
+  for (uint32_t i = 0; i < 40; i++)
+    {
+      Simulator::Schedule (Seconds (1.0 + 0.5 * i), &LrWpanMac::McpsDataRequest, sender, params, Create<Packet> (20));
+    }
+
+  Simulator::Stop (Seconds (21.0));
+  Simulator::Run ();
+  Simulator::Destroy ();
+}
+
+void
+LrWpanSpectrumChannelMobilityTestCase::DoRun (void)
+{
+  std::vector<uint32_t> singleModelRxPackets;
+  RunScenario (false, singleModelRxPackets);
+
+  std::vector<uint32_t> spatialGridRxPackets;
+  RunScenario (true, spatialGridRxPackets);
+
+  for (uint32_t i = 0; i < singleModelRxPackets.size (); i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (spatialGridRxPackets[i], singleModelRxPackets[i],
+                             "Node " << i << " should receive the same packets on both channels");
+    }
+  NS_TEST_ASSERT_MSG_EQ (spatialGridRxPackets[1], 40, "Nearby node should receive all packets");
+  NS_TEST_ASSERT_MSG_GT (spatialGridRxPackets[2], 0, "Moving node should receive the packets sent once in range");
+  NS_TEST_ASSERT_MSG_LT (spatialGridRxPackets[2], 40, "Moving node should not receive the packets sent out of range");
+}
+
+/**
+ * \ingroup lr-wpan-test
+ * \ingroup tests
+ *
+ * \brief LrWpan spatial grid channel TestSuite
+ */
+class LrWpanSpectrumChannelTestSuite : public TestSuite
+{
+public:
+  LrWpanSpectrumChannelTestSuite ();
+};
+
+LrWpanSpectrumChannelTestSuite::LrWpanSpectrumChannelTestSuite ()
+  : TestSuite ("lr-wpan-spectrum-channel", UNIT)
+{
+  AddTestCase (new LrWpanSpectrumChannelTestCase, TestCase::QUICK);
+  AddTestCase (new LrWpanSpectrumChannelMobilityTestCase, TestCase::QUICK);
+}
+
+static LrWpanSpectrumChannelTestSuite g_lrWpanSpectrumChannelTestSuite; //!< Static variable for test initialization
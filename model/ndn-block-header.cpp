@@ -19,16 +19,15 @@
 
 #include "ndn-block-header.hpp"
 
-#include <iosfwd>
-#include <boost/iostreams/concepts.hpp>
-#include <boost/iostreams/stream.hpp>
+#include <deque>
+#include <limits>
+#include <unordered_map>
 
 #include <ndn-cxx/encoding/tlv.hpp>
 #include <ndn-cxx/interest.hpp>
 #include <ndn-cxx/data.hpp>
 #include <ndn-cxx/lp/packet.hpp>
 
-namespace io = boost::iostreams;
 namespace nfdFace = nfd::face;
 
 namespace ns3 {
@@ -73,40 +72,139 @@ BlockHeader::Serialize(ns3::Buffer::Iterator start) const
   start.Write(m_block.wire(), m_block.size());
 }
 
-class Ns3BufferIteratorSource : public io::source {
-public:
-  Ns3BufferIteratorSource(ns3::Buffer::Iterator& is)
-    : m_is(is)
-  {
+/**
+ * @brief Read TLV-TYPE or TLV-LENGTH directly from ns-3 buffer iterator
+ *
+ * Octets of the VAR-NUMBER are also appended to @p tl, so the TL part of the block can be
+ * placed in front of TLV-VALUE without re-encoding.
+ */
+static uint64_t
+readVarNumber(ns3::Buffer::Iterator& i, uint8_t*& tl)
+{
+  if (i.GetRemainingSize() < 1) {
+    throw ::ndn::tlv::Error("Not enough bytes in ns-3 buffer to parse TLV");
   }
 
-  std::streamsize
-  read(char* buf, std::streamsize nMaxRead)
-  {
-    std::streamsize i = 0;
-    for (; i < nMaxRead && !m_is.IsEnd(); ++i) {
-      buf[i] = m_is.ReadU8();
-    }
-    if (i == 0) {
-      return -1;
-    }
-    else {
-      return i;
-    }
+  uint8_t firstOctet = i.ReadU8();
+  *tl++ = firstOctet;
+  if (firstOctet < 253) {
+    return firstOctet;
   }
 
-private:
-  ns3::Buffer::Iterator& m_is;
-};
+  size_t size = firstOctet == 253 ? 2 : (firstOctet == 254 ? 4 : 8);
+  if (i.GetRemainingSize() < size) {
+    throw ::ndn::tlv::Error("Not enough bytes in ns-3 buffer to parse TLV");
+  }
+
+  uint64_t number = 0;
+  for (size_t n = 0; n < size; ++n) {
+    uint8_t octet = i.ReadU8();
+    *tl++ = octet;
+    number = (number << 8) | octet;
+  }
+  return number;
+}
 
 uint32_t
 BlockHeader::Deserialize(ns3::Buffer::Iterator start)
 {
-  io::stream<Ns3BufferIteratorSource> is(start);
-  m_block = ::ndn::Block::fromStream(is);
+  // TLV-TYPE and TLV-LENGTH are at most 9 octets each
+  uint8_t tlBuf[18];
+  uint8_t* tl = tlBuf;
+
+  uint64_t type = readVarNumber(start, tl);
+  uint64_t length = readVarNumber(start, tl);
+  if (type == ::ndn::tlv::Invalid || type > std::numeric_limits<uint32_t>::max()) {
+    throw ::ndn::tlv::Error("Illegal TLV-TYPE in ns-3 buffer");
+  }
+  if (length > start.GetRemainingSize()) {
+    throw ::ndn::tlv::Error("Not enough bytes in ns-3 buffer to fully parse TLV");
+  }
+
+  // single pre-sized wire buffer; TLV-VALUE is copied in one pass straight out of the ns-3 buffer
+  size_t tlSize = tl - tlBuf;
+  auto wire = std::make_shared<::ndn::Buffer>(tlSize + length);
+  std::copy(tlBuf, tl, wire->begin());
+  start.Read(wire->data() + tlSize, static_cast<uint32_t>(length));
+
+  m_block = Block(std::move(wire));
   return m_block.size();
 }
 
+namespace {
+
+struct SharedWireRegistry
+{
+  std::unordered_map<uint64_t, Block> blocks;
+  std::deque<uint64_t> order; ///< UIDs in the order of registration
+  size_t capacity = 1024;
+};
+
+SharedWireRegistry&
+getSharedWireRegistry()
+{
+  static SharedWireRegistry registry;
+  return registry;
+}
+
+} // namespace
+
+void
+BlockHeader::shareWire(Ptr<const ns3::Packet> packet, const Block& block)
+{
+  auto& registry = getSharedWireRegistry();
+  if (registry.capacity == 0) {
+    return;
+  }
+
+  uint64_t uid = packet->GetUid();
+  // unparsed view of the same wire, so handing it out does not copy sub-elements
+  if (registry.blocks.emplace(uid, Block(block, block.begin(), block.end(), false)).second) {
+    registry.order.push_back(uid);
+  }
+
+  while (registry.order.size() > registry.capacity) {
+    registry.blocks.erase(registry.order.front());
+    registry.order.pop_front();
+  }
+}
+
+Block
+BlockHeader::extractBlock(Ptr<const ns3::Packet> packet)
+{
+  auto& registry = getSharedWireRegistry();
+  auto it = registry.blocks.find(packet->GetUid());
+  if (it != registry.blocks.end()) {
+    // the bytes are not compared: code that alters the bytes of a packet in flight calls
+    // unshareWire(), and a packet that was truncated or extended has a different size
+    if (packet->GetSize() == it->second.size()) {
+      return it->second;
+    }
+  }
+
+  BlockHeader header;
+  packet->PeekHeader(header);
+  return std::move(header.getBlock());
+}
+
+void
+BlockHeader::unshareWire(Ptr<const ns3::Packet> packet)
+{
+  // the UID stays in the order queue until it is evicted
+  getSharedWireRegistry().blocks.erase(packet->GetUid());
+}
+
+void
+BlockHeader::setSharedWireCapacity(size_t capacity)
+{
+  auto& registry = getSharedWireRegistry();
+  registry.capacity = capacity;
+  while (registry.order.size() > registry.capacity) {
+    registry.blocks.erase(registry.order.front());
+    registry.order.pop_front();
+  }
+}
+
 void
 BlockHeader::Print(std::ostream& os) const
 {
@@ -21,6 +21,7 @@
 #define NDNSIM_NDN_BLOCK_HEADER_HPP
 
 #include "ns3/header.h"
+#include "ns3/packet.h"
 
 #include "ndn-common.hpp"
 
@@ -59,6 +60,49 @@ public:
   const Block&
   getBlock() const;
 
+public:
+  /**
+   * @brief Remember the block that was just serialized into @p packet
+   *
+   * All copies of @p packet (e.g., clones delivered by a broadcast channel to each receiver)
+   * keep the same UID, which allows extractBlock() to return @p block sharing its wire buffer
+   * instead of deserializing another copy of the bytes for every receiver.
+   */
+  static void
+  shareWire(Ptr<const ns3::Packet> packet, const Block& block);
+
+  /**
+   * @brief Get block carried by @p packet
+   *
+   * If the block was registered with shareWire() and the packet still has the same size, the
+   * registered block is returned sharing its wire, without reading the bytes of the packet.
+   * Otherwise, or if unshareWire() was called for the packet, the block is deserialized from
+   * the packet.
+   *
+   * @throw tlv::Error the packet does not contain a valid block
+   */
+  static Block
+  extractBlock(Ptr<const ns3::Packet> packet);
+
+  /**
+   * @brief Stop sharing the block registered for @p packet
+   *
+   * Code that alters the bytes of a packet in flight without changing its UID (e.g., an error
+   * model flipping bits, rather than dropping the packet as ns-3 error models do) must call
+   * this, so that receivers deserialize the altered bytes.
+   */
+  static void
+  unshareWire(Ptr<const ns3::Packet> packet);
+
+  /**
+   * @brief Set maximum number of recently sent blocks available to extractBlock()
+   *
+   * The default is 1024.  Zero disables wire sharing, so every receiver deserializes its own
+   * copy of the block.
+   */
+  static void
+  setSharedWireCapacity(size_t capacity);
+
 private:
   Block m_block;
 };
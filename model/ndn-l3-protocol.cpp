@@ -24,6 +24,7 @@
 #include "ns3/log.h"
 #include "ns3/callback.h"
 #include "ns3/uinteger.h"
+#include "ns3/double.h"
 #include "ns3/trace-source-accessor.h"
 #include "ns3/object-vector.h"
 #include "ns3/pointer.h"
@@ -76,6 +77,18 @@ L3Protocol::GetTypeId(void)
       .SetParent<Object>()
       .AddConstructor<L3Protocol>()
 
+      .AddAttribute("RebroadcastProbability",
+                    "Probability of forwarding an Interest received on the broadcast face "
+                    "back to the broadcast face",
+                    DoubleValue(0.85),
+                    MakeDoubleAccessor(&L3Protocol::m_rebroadcastProbability),
+                    MakeDoubleChecker<double>(0.0, 1.0))
+      .AddAttribute("BroadcastFaceId",
+                    "ID of the face on which Interests are re-broadcast probabilistically",
+                    UintegerValue(257),
+                    MakeUintegerAccessor(&L3Protocol::m_broadcastFaceId),
+                    MakeUintegerChecker<nfd::FaceId>())
+
       .AddTraceSource("OutInterests", "OutInterests",
                       MakeTraceSourceAccessor(&L3Protocol::m_outInterests),
                       "ns3::ndn::L3Protocol::InterestTraceCallback")
@@ -111,7 +124,10 @@ L3Protocol::GetTypeId(void)
 
 class L3Protocol::Impl {
 private:
-  Impl()
+  /** \brief parse the initial NFD config, which is only needed when management is enabled
+   */
+  void
+  loadConfig()
   {
     // Do not modify initial config file. Use helpers to set specific NFD parameters
     std::string initialConfig =
@@ -164,6 +180,7 @@ private:
 
     std::istringstream input(initialConfig);
     boost::property_tree::read_info(input, m_config);
+    m_isConfigLoaded = true;
   }
 
   friend class L3Protocol;
@@ -192,6 +209,10 @@ private:
   std::unique_ptr<::nfd::rib::Service> m_ribService;
 
   nfd::ConfigSection m_config;
+  bool m_isConfigLoaded = false;
+
+  bool m_isMinimal = false;
+  MinimalProfile m_minimalProfile;
 
   PolicyCreationCallback m_policy;
 };
@@ -207,15 +228,42 @@ L3Protocol::~L3Protocol()
   NS_LOG_FUNCTION(this);
 }
 
+void
+L3Protocol::setMinimalProfile(const MinimalProfile& profile)
+{
+  NS_ASSERT_MSG(m_node == nullptr, "L3Protocol is already aggregated on a node");
+  m_impl->m_isMinimal = true;
+  m_impl->m_minimalProfile = profile;
+}
+
+bool
+L3Protocol::isManagementEnabled() const
+{
+  return !m_impl->m_isMinimal;
+}
+
 void
 L3Protocol::initialize()
 {
   m_impl->m_faceTable = make_unique<::nfd::FaceTable>();
-  m_impl->m_forwarder = make_shared<::nfd::Forwarder>(*m_impl->m_faceTable);
-  m_impl->m_faceSystem = make_unique<::nfd::face::FaceSystem>(*m_impl->m_faceTable, nullptr);
-
-  initializeManagement();
-  initializeRibManager();
+  bool isNameTreeOpenAddressing = m_impl->m_isMinimal ?
+                                  m_impl->m_minimalProfile.isNameTreeOpenAddressing :
+                                  this->getConfig().get<bool>("ndnSIM.name_tree_open_addressing", false);
+  auto nameTreeLayout = isNameTreeOpenAddressing ?
+                        ::nfd::name_tree::HashtableLayout::OPEN_ADDRESSING :
+                        ::nfd::name_tree::HashtableLayout::CHAINED;
+  m_impl->m_forwarder = make_shared<::nfd::Forwarder>(*m_impl->m_faceTable, nameTreeLayout);
+  m_impl->m_forwarder->setRebroadcastProbability(m_rebroadcastProbability);
+  m_impl->m_forwarder->setBroadcastFaceId(m_broadcastFaceId);
+
+  if (m_impl->m_isMinimal) {
+    initializeMinimal();
+  }
+  else {
+    m_impl->m_faceSystem = make_unique<::nfd::face::FaceSystem>(*m_impl->m_faceTable, nullptr);
+    initializeManagement();
+    initializeRibManager();
+  }
 
   m_impl->m_forwarder->beforeSatisfyInterest.connect(std::ref(m_satisfiedInterests));
   m_impl->m_forwarder->beforeExpirePendingInterest.connect(std::ref(m_timedOutInterests));
@@ -245,6 +293,8 @@ private:
 void
 L3Protocol::injectInterest(const Interest& interest)
 {
+  NS_ASSERT_MSG(m_impl->m_internalClientFaceForInjects != nullptr,
+                "Interests cannot be injected without NFD management (minimal profile)");
   m_impl->m_internalClientFaceForInjects->expressInterest(interest, nullptr, nullptr, nullptr);
 }
 
@@ -289,6 +339,9 @@ L3Protocol::initializeManagement()
   ConfigFile config(&ConfigFile::ignoreUnknownSection);
 
   forwarder->getCs().setPolicy(m_impl->m_policy());
+  forwarder->getCs().enableWireOnly(this->getConfig().get<bool>("ndnSIM.cs_wire_only", false));
+  forwarder->getDeadNonceList().enableQuotientFilter(
+    this->getConfig().get<double>("ndnSIM.dnl_false_positive_rate", 0.0));
 
   TablesConfigSection tablesConfig(*forwarder);
   tablesConfig.setConfigFile(config);
@@ -300,7 +353,7 @@ L3Protocol::initializeManagement()
   // }
 
   // apply config
-  config.parse(m_impl->m_config, false, "ndnSIM.conf");
+  config.parse(this->getConfig(), false, "ndnSIM.conf");
 
   tablesConfig.ensureConfigured();
 
@@ -319,11 +372,30 @@ L3Protocol::initializeRibManager()
   std::tie(m_impl->m_internalRibFace, m_impl->m_internalRibClientFace) = face::makeInternalFace(StackHelper::getKeyChain());
   m_impl->m_faceTable->add(m_impl->m_internalRibFace);
 
-  m_impl->m_ribService = make_unique<rib::Service>(m_impl->m_config,
+  m_impl->m_ribService = make_unique<rib::Service>(this->getConfig(),
                                                    std::ref(*m_impl->m_internalRibClientFace),
                                                    std::ref(StackHelper::getKeyChain()));
 }
 
+void
+L3Protocol::initializeMinimal()
+{
+  auto& forwarder = m_impl->m_forwarder;
+  const auto& profile = m_impl->m_minimalProfile;
+
+  forwarder->getCs().setPolicy(m_impl->m_policy());
+  forwarder->getCs().setLimit(profile.csMaxPackets);
+  forwarder->getCs().enableWireOnly(profile.isCsWireOnly);
+  forwarder->getDeadNonceList().enableQuotientFilter(profile.dnlFalsePositiveRate);
+
+  // same strategy choices as the "tables" section of the initial config
+  nfd::StrategyChoice& sc = forwarder->getStrategyChoice();
+  sc.insert("/", "/localhost/nfd/strategy/best-route");
+  sc.insert("/localhost", "/localhost/nfd/strategy/multicast");
+  sc.insert("/localhost/nfd", "/localhost/nfd/strategy/best-route");
+  sc.insert("/ndn/multicast", "/localhost/nfd/strategy/multicast");
+}
+
 shared_ptr<nfd::Forwarder>
 L3Protocol::getForwarder()
 {
@@ -357,6 +429,9 @@ L3Protocol::getRibService()
 nfd::ConfigSection&
 L3Protocol::getConfig()
 {
+  if (!m_impl->m_isConfigLoaded) {
+    m_impl->loadConfig();
+  }
   return m_impl->m_config;
 }
 
@@ -469,6 +544,13 @@ L3Protocol::getFaceByNetDevice(Ptr<NetDevice> netDevice) const
   return nullptr;
 }
 
+int64_t
+L3Protocol::AssignStreams(int64_t stream)
+{
+  NS_ASSERT_MSG(m_impl->m_forwarder != nullptr, "L3Protocol is not aggregated on a node");
+  return m_impl->m_forwarder->assignStreams(stream);
+}
+
 Ptr<L3Protocol>
 L3Protocol::getL3Protocol(Ptr<Object> node)
 {
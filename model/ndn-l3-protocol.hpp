@@ -99,6 +99,39 @@ public:
 
   virtual ~L3Protocol();
 
+  /**
+   * \brief Options of the minimal NFD profile
+   *
+   * In this profile, the forwarder and its tables are set up directly from these options:
+   * no NFD config is parsed, and neither management (dispatcher, managers, internal faces)
+   * nor the RIB service is created.  FibHelper and StrategyChoiceHelper then update the FIB
+   * and the StrategyChoice table directly instead of sending management commands.
+   */
+  struct MinimalProfile
+  {
+    size_t csMaxPackets = 100;
+    bool isCsWireOnly = false;
+    double dnlFalsePositiveRate = 0.0;
+    bool isNameTreeOpenAddressing = false;
+  };
+
+  /**
+   * \brief Use the minimal NFD profile
+   *
+   * Must be called before L3Protocol is aggregated to a node.
+   */
+  void
+  setMinimalProfile(const MinimalProfile& profile);
+
+  /**
+   * \brief Whether NFD management is available, i.e., the minimal profile is not used
+   *
+   * Without management, getFibManager() returns nullptr, and getStrategyChoiceManager(),
+   * getRibService() and injectInterest() must not be called.
+   */
+  bool
+  isManagementEnabled() const;
+
   /**
    * \brief Get smart pointer to nfd::Forwarder installed on the node
    */
@@ -174,6 +207,16 @@ public:
   void
   setCsReplacementPolicy(const PolicyCreationCallback& policy);
 
+  /**
+   * \brief Assign a fixed random variable stream number to the random variables used by the
+   *        forwarder (probabilistic re-broadcast decision) and by its strategies
+   *
+   * \param stream first stream index to use
+   * \return the number of stream indices assigned
+   */
+  int64_t
+  AssignStreams(int64_t stream);
+
 public: // Workaround for python bindings
   static Ptr<L3Protocol>
   getL3Protocol(Ptr<Object> node);
@@ -208,6 +251,9 @@ private:
   void
   initializeRibManager();
 
+  void
+  initializeMinimal();
+
 private:
   class Impl;
   std::unique_ptr<Impl> m_impl;
@@ -215,6 +261,9 @@ private:
   // These objects are aggregated, but for optimization, get them here
   Ptr<Node> m_node; ///< \brief node on which ndn stack is installed
 
+  double m_rebroadcastProbability;
+  nfd::FaceId m_broadcastFaceId;
+
   TracedCallback<const Interest&, const Face&>
     m_inInterests; ///< @brief trace of incoming Interests
   TracedCallback<const Interest&, const Face&>
@@ -116,12 +116,27 @@ NetDeviceTransport::doSend(const Block& packet, const nfd::EndpointId& endpoint)
 
   Ptr<ns3::Packet> ns3Packet = Create<ns3::Packet>();
   ns3Packet->AddHeader(header);
+  // the bytes are written only once; receivers of this transmission share the encoded block
+  BlockHeader::shareWire(ns3Packet, packet);
 
-  // send the NS3 packet
+  // send the NS3 packet; all neighbours on the channel receive it, whatever the endpoint
   m_netDevice->Send(ns3Packet, m_netDevice->GetBroadcast(),
                     L3Protocol::ETHERNET_FRAME_TYPE);
 }
 
+nfd::EndpointId
+NetDeviceTransport::getEndpointId(const Address& address)
+{
+  if (m_lastEndpointId != 0 && address == m_lastSender) {
+    return m_lastEndpointId;
+  }
+
+  auto it = m_endpointIds.emplace(address, m_endpointIds.size() + 1).first;
+  m_lastSender = address;
+  m_lastEndpointId = it->second;
+  return m_lastEndpointId;
+}
+
 // callback
 void
 NetDeviceTransport::receiveFromNetDevice(Ptr<NetDevice> device,
@@ -132,13 +147,9 @@ NetDeviceTransport::receiveFromNetDevice(Ptr<NetDevice> device,
 {
   NS_LOG_FUNCTION(device << p << protocol << from << to << packetType);
 
-  // Convert NS3 packet to NFD packet
-  Ptr<ns3::Packet> packet = p->Copy();
-
-  BlockHeader header;
-  packet->RemoveHeader(header);
-
-  this->receive(std::move(header.getBlock()));
+  // Convert NS3 packet to NFD packet; neither the packet nor the wire of the block is copied
+  // when the sender's block is still known
+  this->receive(BlockHeader::extractBlock(p), this->getEndpointId(from));
 }
 
 Ptr<NetDevice>
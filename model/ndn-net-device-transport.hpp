@@ -32,6 +32,8 @@
 #include "ns3/point-to-point-net-device.h"
 #include "ns3/channel.h"
 
+#include <map>
+
 namespace ns3 {
 namespace ndn {
 
@@ -57,6 +59,16 @@ public:
   virtual ssize_t
   getSendQueueLength() final;
 
+  /**
+   * \brief Get the EndpointId of packets received from a link-layer address
+   *
+   * Each sender on the channel gets its own EndpointId, so that GenericLinkService keeps the
+   * fragments of concurrent senders apart.  EndpointIds are assigned in the order the senders
+   * are first heard, starting at 1, and do not change afterwards.
+   */
+  nfd::EndpointId
+  getEndpointId(const Address& address);
+
 private:
   virtual void
   doClose() override;
@@ -73,6 +85,10 @@ private:
 
   Ptr<NetDevice> m_netDevice; ///< \brief Smart pointer to NetDevice
   Ptr<Node> m_node;
+
+  std::map<Address, nfd::EndpointId> m_endpointIds;
+  Address m_lastSender; ///< \brief address of the last sender, fragments often come in a row
+  nfd::EndpointId m_lastEndpointId = 0;
 };
 
 } // namespace ndn
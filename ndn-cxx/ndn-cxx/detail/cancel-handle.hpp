@@ -53,13 +53,12 @@ inline
 CancelHandle::CancelHandle() noexcept = default;
 
 /** \brief Cancels an operation automatically upon destruction.
+ *  \tparam HandleT a CancelHandle subclass, or another default-constructible handle type with
+ *                  a cancel() member function and an explicit conversion to bool
  */
 template<typename HandleT>
 class ScopedCancelHandle
 {
-  static_assert(std::is_convertible<HandleT*, CancelHandle*>::value,
-                "HandleT must publicly derive from CancelHandle");
-
 public:
   ScopedCancelHandle() noexcept;
 
@@ -20,10 +20,23 @@
  */
 
 #include "ndn-cxx/detail/packet-base.hpp"
+#include "ndn-cxx/lp/pit-token.hpp"
 #include "ndn-cxx/lp/tags.hpp"
 
 namespace ndn {
 
+// TagHost::getSlot assigns the fixed slots by type id; renumbering any of these tags must
+// come with an update of getSlot, otherwise the tag would share a slot or fall back to the map
+static_assert(lp::IncomingFaceIdTag::getTypeId() == 10, "TagHost slot 0");
+static_assert(lp::NextHopFaceIdTag::getTypeId() == 11, "TagHost slot 1");
+static_assert(lp::CachePolicyTag::getTypeId() == 12, "TagHost slot 2");
+static_assert(lp::CongestionMarkTag::getTypeId() == 13, "TagHost slot 3");
+static_assert(lp::NonDiscoveryTag::getTypeId() == 14, "TagHost slot 4");
+static_assert(lp::PrefixAnnouncementTag::getTypeId() == 15, "TagHost slot 5");
+static_assert(lp::PitToken::getTypeId() == 98, "TagHost slot 6");
+static_assert(lp::HopCountTag::getTypeId() == 0x60000000, "TagHost slot 7");
+static_assert(lp::GeoTag::getTypeId() == 0x60000001, "TagHost slot 8");
+
 uint64_t
 PacketBase::getCongestionMark() const
 {
@@ -25,11 +25,15 @@
 #include "ndn-cxx/detail/common.hpp"
 #include "ndn-cxx/tag.hpp"
 
+#include <array>
 #include <map>
 
 namespace ndn {
 
 /** \brief Base class to store tag information (e.g., inside Interest and Data packets)
+ *
+ *  Tags set by the link layer and the forwarder on every packet are stored in fixed slots,
+ *  whose index is computed at compile time from the tag type id. Other tags are stored in a map.
  */
 class TagHost
 {
@@ -58,6 +62,36 @@ public:
   removeTag() const;
 
 private:
+  /** \return index of the fixed slot for tags of type \p typeId, or N_SLOTS if these tags are
+   *          stored in m_tags
+   *  \note The type ids below are checked against the tag definitions in packet-base.cpp
+   */
+  static constexpr size_t
+  getSlot(int typeId) noexcept
+  {
+    switch (typeId) {
+      case 10: // lp::IncomingFaceIdTag
+      case 11: // lp::NextHopFaceIdTag
+      case 12: // lp::CachePolicyTag
+      case 13: // lp::CongestionMarkTag
+      case 14: // lp::NonDiscoveryTag
+      case 15: // lp::PrefixAnnouncementTag
+        return static_cast<size_t>(typeId - 10);
+      case 98: // lp::PitToken
+        return 6;
+      case 0x60000000: // lp::HopCountTag
+        return 7;
+      case 0x60000001: // lp::GeoTag
+        return 8;
+      default:
+        return N_SLOTS;
+    }
+  }
+
+private:
+  static constexpr size_t N_SLOTS = 9;
+
+  mutable std::array<shared_ptr<Tag>, N_SLOTS> m_slots;
   mutable std::map<int, shared_ptr<Tag>> m_tags;
 };
 
@@ -67,6 +101,11 @@ TagHost::getTag() const
 {
   static_assert(std::is_base_of<Tag, T>::value, "T must inherit from Tag");
 
+  constexpr size_t slot = getSlot(T::getTypeId());
+  if (slot < N_SLOTS) {
+    return static_pointer_cast<T>(m_slots[slot]);
+  }
+
   auto it = m_tags.find(T::getTypeId());
   if (it == m_tags.end()) {
     return nullptr;
@@ -80,6 +119,12 @@ TagHost::setTag(shared_ptr<T> tag) const
 {
   static_assert(std::is_base_of<Tag, T>::value, "T must inherit from Tag");
 
+  constexpr size_t slot = getSlot(T::getTypeId());
+  if (slot < N_SLOTS) {
+    m_slots[slot] = std::move(tag);
+    return;
+  }
+
   if (tag == nullptr) {
     m_tags.erase(T::getTypeId());
   }
@@ -128,6 +128,19 @@ typedef FieldDecl<field_location_tags::Header,
                   tlv::GeoTag> GeoTagField;
 BOOST_CONCEPT_ASSERT((Field<GeoTagField>));
 
+/** \brief Declare the NamePrefixContext field.
+ *
+ *  Index of a Name prefix, shared by the nodes of a link, that was removed from the Name of
+ *  the network-layer packet.
+ */
+typedef FieldDecl<field_location_tags::Header,
+                  uint64_t,
+                  tlv::NamePrefixContext,
+                  false,
+                  NonNegativeIntegerTag,
+                  NonNegativeIntegerTag> NamePrefixContextField;
+BOOST_CONCEPT_ASSERT((Field<NamePrefixContextField>));
+
 /** \brief Declare the Fragment field.
  *
  *  The fragment (i.e. payload) is the bytes between two provided iterators. During encoding,
@@ -156,7 +169,8 @@ typedef boost::mpl::set<
   NonDiscoveryField,
   PrefixAnnouncementField,
   HopCountTagField,
-  GeoTagField
+  GeoTagField,
+  NamePrefixContextField
   > FieldSet;
 
 } // namespace lp
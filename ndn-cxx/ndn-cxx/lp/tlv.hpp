@@ -38,6 +38,7 @@ enum {
   HopCountTag = 84,
   GeoTag = 85,
   GeoTagPos = 85, // inner fields inside GeoTag
+  NamePrefixContext = 86,
   PitToken = 98,
   Nack = 800,
   NackReason = 801,
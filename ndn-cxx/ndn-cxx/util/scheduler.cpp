@@ -23,21 +23,16 @@
 
 #include <boost/scope_exit.hpp>
 
+#include <deque>
+
 namespace ndn {
 namespace scheduler {
 
 /** \brief Stores internal information about a scheduled event
  */
-class EventInfo : noncopyable
+class EventInfo
 {
 public:
-  EventInfo(time::nanoseconds after, EventCallback&& cb, uint32_t context)
-    : callback(std::move(cb))
-    , expireTime(time::steady_clock::now() + after)
-    , context(context)
-  {
-  }
-
   NDN_CXX_NODISCARD time::nanoseconds
   expiresFromNow() const
   {
@@ -46,22 +41,93 @@ public:
 
 public:
   EventCallback callback;
-  Scheduler::EventQueue::const_iterator queueIt;
   time::steady_clock::TimePoint expireTime;
-  bool isExpired = false;
+  uint64_t sequence = 0;
+  Scheduler* owner = nullptr; ///< nullptr if the record is free
+  uint32_t generation = 1;
+  uint32_t heapIndex = 0;
   uint32_t context = 0;
 };
 
-EventId::EventId(Scheduler& sched, weak_ptr<EventInfo> info)
-  : CancelHandle([&sched, info] { sched.cancelImpl(info.lock()); })
-  , m_info(std::move(info))
+namespace {
+
+/** \brief Records of the events of all schedulers in the thread
+ *
+ *  Records are never moved in memory, and are reused after their event expires or is canceled.
+ */
+class EventPool : noncopyable
 {
+public:
+  EventInfo&
+  operator[](uint32_t index)
+  {
+    return m_infos[index];
+  }
+
+  bool
+  isPending(uint32_t index, uint32_t generation) const
+  {
+    return index < m_infos.size() && m_infos[index].generation == generation &&
+           m_infos[index].owner != nullptr;
+  }
+
+  uint32_t
+  acquire()
+  {
+    if (m_free.empty()) {
+      m_infos.emplace_back();
+      return static_cast<uint32_t>(m_infos.size() - 1);
+    }
+    uint32_t index = m_free.back();
+    m_free.pop_back();
+    return index;
+  }
+
+  /** \brief invalidate the EventIds of the record, and make it available for reuse
+   */
+  void
+  release(uint32_t index)
+  {
+    EventInfo& info = m_infos[index];
+    info.callback = nullptr;
+    info.owner = nullptr;
+    if (++info.generation == 0) {
+      info.generation = 1;
+    }
+    m_free.push_back(index);
+  }
+
+private:
+  std::deque<EventInfo> m_infos;
+  std::vector<uint32_t> m_free;
+};
+
+/** \note The pool is never destructed, so that EventIds can be canceled from destructors that
+ *        run after the end of the thread.
+ */
+EventPool&
+getPool()
+{
+  static thread_local EventPool* pool = new EventPool;
+  return *pool;
 }
 
+const size_t HEAP_ARITY = 4;
+
+} // namespace
+
 EventId::operator bool() const noexcept
 {
-  auto sp = m_info.lock();
-  return sp != nullptr && !sp->isExpired;
+  return getPool().isPending(m_index, m_generation);
+}
+
+void
+EventId::cancel() const
+{
+  EventPool& pool = getPool();
+  if (pool.isPending(m_index, m_generation)) {
+    pool[m_index].owner->cancelImpl(m_index);
+  }
 }
 
 void
@@ -73,14 +139,10 @@ EventId::reset() noexcept
 std::ostream&
 operator<<(std::ostream& os, const EventId& eventId)
 {
-  return os << eventId.m_info.lock();
-}
-
-bool
-Scheduler::EventQueueCompare::operator()(const shared_ptr<EventInfo>& a,
-                                         const shared_ptr<EventInfo>& b) const noexcept
-{
-  return a->expireTime < b->expireTime;
+  if (!eventId) {
+    return os << static_cast<const void*>(nullptr);
+  }
+  return os << static_cast<const void*>(&getPool()[eventId.m_index]);
 }
 
 Scheduler::Scheduler(DummyIoService& ioService)
@@ -97,41 +159,132 @@ Scheduler::schedule(time::nanoseconds after, EventCallback callback)
 {
   BOOST_ASSERT(callback != nullptr);
 
-  auto i = m_queue.insert(make_shared<EventInfo>(after, std::move(callback), ns3::Simulator::GetContext()));
-  (*i)->queueIt = i;
+  EventPool& pool = getPool();
+  uint32_t index = pool.acquire();
+  EventInfo& info = pool[index];
+  info.callback = std::move(callback);
+  info.expireTime = time::steady_clock::now() + after;
+  info.sequence = m_nextSequence++;
+  info.owner = this;
+  info.context = ns3::Simulator::GetContext();
+
+  info.heapIndex = static_cast<uint32_t>(m_heap.size());
+  m_heap.push_back(index);
+  this->siftUp(info.heapIndex);
 
-  if (!m_isEventExecuting && i == m_queue.begin()) {
+  if (!m_isEventExecuting && info.heapIndex == 0) {
     // the new event is the first one to expire
+    this->cancelTimer();
     this->scheduleNext();
   }
 
-  return EventId(*this, *i);
+  return EventId(index, info.generation);
 }
 
 void
-Scheduler::cancelImpl(const shared_ptr<EventInfo>& info)
+Scheduler::cancelImpl(uint32_t index)
 {
-  if (info == nullptr || info->isExpired) {
-    return;
+  EventPool& pool = getPool();
+  uint32_t pos = pool[index].heapIndex;
+  this->removeFromHeap(pos);
+  pool.release(index);
+
+  if (pos == 0 && !m_isEventExecuting) {
+    this->cancelTimer();
+    this->scheduleNext();
   }
+}
 
-  if (m_timerEvent) {
-    if (!m_timerEvent->IsExpired()) {
-      ns3::Simulator::Remove(*m_timerEvent);
+void
+Scheduler::cancelAllEvents()
+{
+  EventPool& pool = getPool();
+  for (uint32_t index : m_heap) {
+    pool.release(index);
+  }
+  m_heap.clear();
+  this->cancelTimer();
+}
+
+bool
+Scheduler::isBefore(uint32_t lhs, uint32_t rhs) const
+{
+  EventPool& pool = getPool();
+  const EventInfo& a = pool[lhs];
+  const EventInfo& b = pool[rhs];
+  return a.expireTime < b.expireTime ||
+         (a.expireTime == b.expireTime && a.sequence < b.sequence);
+}
+
+void
+Scheduler::siftUp(size_t pos)
+{
+  EventPool& pool = getPool();
+  uint32_t index = m_heap[pos];
+  while (pos > 0) {
+    size_t parent = (pos - 1) / HEAP_ARITY;
+    if (!this->isBefore(index, m_heap[parent])) {
+      break;
     }
-    m_timerEvent.reset();
+    m_heap[pos] = m_heap[parent];
+    pool[m_heap[pos]].heapIndex = static_cast<uint32_t>(pos);
+    pos = parent;
+  }
+  m_heap[pos] = index;
+  pool[index].heapIndex = static_cast<uint32_t>(pos);
+}
+
+void
+Scheduler::siftDown(size_t pos)
+{
+  EventPool& pool = getPool();
+  uint32_t index = m_heap[pos];
+  while (true) {
+    size_t first = pos * HEAP_ARITY + 1;
+    if (first >= m_heap.size()) {
+      break;
+    }
+    size_t last = std::min(first + HEAP_ARITY, m_heap.size());
+    size_t child = first;
+    for (size_t i = first + 1; i < last; ++i) {
+      if (this->isBefore(m_heap[i], m_heap[child])) {
+        child = i;
+      }
+    }
+    if (!this->isBefore(m_heap[child], index)) {
+      break;
+    }
+    m_heap[pos] = m_heap[child];
+    pool[m_heap[pos]].heapIndex = static_cast<uint32_t>(pos);
+    pos = child;
+  }
+  m_heap[pos] = index;
+  pool[index].heapIndex = static_cast<uint32_t>(pos);
+}
+
+void
+Scheduler::removeFromHeap(size_t pos)
+{
+  BOOST_ASSERT(pos < m_heap.size());
+
+  uint32_t last = m_heap.back();
+  m_heap.pop_back();
+  if (pos == m_heap.size()) {
+    return;
   }
-  m_queue.erase(info->queueIt);
 
-  if (!m_isEventExecuting) {
-    this->scheduleNext();
+  m_heap[pos] = last;
+  if (pos > 0 && this->isBefore(last, m_heap[(pos - 1) / HEAP_ARITY])) {
+    this->siftUp(pos);
+  }
+  else {
+    this->siftDown(pos);
   }
 }
 
 void
-Scheduler::cancelAllEvents()
+Scheduler::cancelTimer()
 {
-  m_queue.clear();
   if (m_timerEvent) {
     if (!m_timerEvent->IsExpired()) {
       ns3::Simulator::Remove(*m_timerEvent);
@@ -143,8 +296,9 @@ Scheduler::cancelAllEvents()
 void
 Scheduler::scheduleNext()
 {
-  if (!m_queue.empty()) {
-    m_timerEvent = ns3::Simulator::Schedule(ns3::NanoSeconds((*m_queue.begin())->expiresFromNow().count()),
+  if (!m_heap.empty()) {
+    time::nanoseconds delay = getPool()[m_heap.front()].expiresFromNow();
+    m_timerEvent = ns3::Simulator::Schedule(ns3::NanoSeconds(delay.count()),
                                             &Scheduler::executeEvent, this);
   }
 }
@@ -161,21 +315,25 @@ Scheduler::executeEvent()
   } BOOST_SCOPE_EXIT_END
 
   // process all expired events
+  EventPool& pool = getPool();
   auto now = time::steady_clock::now();
-  while (!m_queue.empty()) {
-    auto head = m_queue.begin();
-    shared_ptr<EventInfo> info = *head;
-    if (info->expireTime > now) {
+  while (!m_heap.empty()) {
+    uint32_t index = m_heap.front();
+    EventInfo& info = pool[index];
+    if (info.expireTime > now) {
       break;
     }
 
-    m_queue.erase(head);
-    info->isExpired = true;
-    if (ns3::Simulator::GetContext() == info->context) {
-      info->callback();
+    this->removeFromHeap(0);
+    EventCallback callback = std::move(info.callback);
+    uint32_t context = info.context;
+    pool.release(index);
+
+    if (ns3::Simulator::GetContext() == context) {
+      callback();
     }
     else {
-      ns3::Simulator::ScheduleWithContext(info->context, ns3::Seconds(0), ns3::MakeEvent(info->callback));
+      ns3::Simulator::ScheduleWithContext(context, ns3::Seconds(0), ns3::MakeEvent(callback));
     }
   }
 }
@@ -28,7 +28,7 @@
 
 #include "ns3/simulator.h"
 
-#include <set>
+#include <vector>
 
 namespace ndn {
 
@@ -38,7 +38,6 @@ namespace util {
 namespace scheduler {
 
 class Scheduler;
-class EventInfo;
 
 /** \brief Function to be invoked when a scheduled event expires
  */
@@ -51,11 +50,14 @@ using EventCallback = std::function<void()>;
  *  eid.cancel(); // cancel the event
  *  \endcode
  *
- *  \note Canceling an expired (executed) or canceled event has no effect.
- *  \warning Canceling an event after the scheduler has been destructed may trigger undefined
- *           behavior.
+ *  The handle refers to a pooled event record by index and generation. The generation changes
+ *  whenever the event expires or is canceled, which invalidates all handles to it; copying and
+ *  canceling a handle therefore never allocates.
+ *
+ *  \note Canceling an expired (executed) or canceled event has no effect, including after the
+ *        scheduler has been destructed.
  */
-class EventId : public detail::CancelHandle
+class EventId
 {
 public:
   /** \brief Constructs an empty EventId
@@ -69,6 +71,11 @@ public:
   explicit
   operator bool() const noexcept;
 
+  /** \brief Cancel the event.
+   */
+  void
+  cancel() const;
+
   /** \brief Clear this EventId without canceling.
    *  \post !(*this)
    */
@@ -86,8 +93,7 @@ private:
   operator==(const EventId& lhs, const EventId& rhs) noexcept
   {
     return (!lhs && !rhs) ||
-        (!lhs.m_info.owner_before(rhs.m_info) &&
-         !rhs.m_info.owner_before(lhs.m_info));
+        (lhs.m_index == rhs.m_index && lhs.m_generation == rhs.m_generation);
   }
 
   friend bool
@@ -97,10 +103,15 @@ private:
   }
 
 private:
-  EventId(Scheduler& sched, weak_ptr<EventInfo> info);
+  EventId(uint32_t index, uint32_t generation) noexcept
+    : m_index(index)
+    , m_generation(generation)
+  {
+  }
 
 private:
-  weak_ptr<EventInfo> m_info;
+  uint32_t m_index = 0;
+  uint32_t m_generation = 0; ///< generation 0 is never valid
 
   friend class Scheduler;
   friend std::ostream& operator<<(std::ostream& os, const EventId& eventId);
@@ -122,12 +133,15 @@ operator<<(std::ostream& os, const EventId& eventId);
  *  \endcode
  *
  *  \note Canceling an expired (executed) or canceled event has no effect.
- *  \warning Canceling an event after the scheduler has been destructed may trigger undefined
- *           behavior.
  */
 using ScopedEventId = detail::ScopedCancelHandle<EventId>;
 
 /** \brief Generic time-based scheduler
+ *
+ *  Event records are taken from a per-thread pool shared by all schedulers and recycled when the
+ *  event expires or is canceled. Pending events are kept in a 4-ary min-heap of record indices,
+ *  ordered by expiry time and then by scheduling order; each record knows its position in the
+ *  heap, so that canceling an event does not search for it.
  */
 class Scheduler : noncopyable
 {
@@ -150,7 +164,24 @@ public:
 
 private:
   void
-  cancelImpl(const shared_ptr<EventInfo>& info);
+  cancelImpl(uint32_t index);
+
+  bool
+  isBefore(uint32_t lhs, uint32_t rhs) const;
+
+  void
+  siftUp(size_t pos);
+
+  void
+  siftDown(size_t pos);
+
+  void
+  removeFromHeap(size_t pos);
+
+  /** \brief Cancel the internal timer
+   */
+  void
+  cancelTimer();
 
   /** \brief Schedule the next event on the internal timer
    */
@@ -163,21 +194,13 @@ private:
   executeEvent();
 
 private:
-  class EventQueueCompare
-  {
-  public:
-    bool
-    operator()(const shared_ptr<EventInfo>& a, const shared_ptr<EventInfo>& b) const noexcept;
-  };
-
-  using EventQueue = std::multiset<shared_ptr<EventInfo>, EventQueueCompare>;
-  EventQueue m_queue;
+  std::vector<uint32_t> m_heap; ///< indices of pending event records
+  uint64_t m_nextSequence = 0;
 
   bool m_isEventExecuting = false;
   ndn::optional<ns3::EventId> m_timerEvent;
 
   friend EventId;
-  friend EventInfo;
 };
 
 } // namespace scheduler
@@ -0,0 +1,45 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_TESTS_OTHER_BENCHMARK_COMMON_HPP
+#define NDNSIM_TESTS_OTHER_BENCHMARK_COMMON_HPP
+
+#include <chrono>
+#include <cstddef>
+
+namespace ns3 {
+
+/** \brief call \p f with each iteration number in [0, \p nIterations)
+ *  \return wall-clock time of all iterations in seconds
+ */
+template<typename F>
+double
+measure(size_t nIterations, const F& f)
+{
+  auto before = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < nIterations; ++i) {
+    f(i);
+  }
+  auto after = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(after - before).count();
+}
+
+} // namespace ns3
+
+#endif // NDNSIM_TESTS_OTHER_BENCHMARK_COMMON_HPP
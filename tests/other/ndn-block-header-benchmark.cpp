@@ -0,0 +1,142 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-block-header-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/model/ndn-block-header.hpp"
+
+#include "benchmark-common.hpp"
+
+#include <boost/iostreams/concepts.hpp>
+#include <boost/iostreams/stream.hpp>
+
+#include <iostream>
+
+namespace ns3 {
+
+namespace io = boost::iostreams;
+
+/**
+ * Receive-path decoding benchmark for ndn::BlockHeader
+ *
+ * Compares the original byte-by-byte boost::iostreams decoding (with a copy of the ns-3
+ * packet) against the current BlockHeader::Deserialize used via Packet::PeekHeader.
+ *
+ *     ./waf --run ndn-block-header-benchmark --command-template="%s --iterations=100000"
+ */
+
+class Ns3BufferIteratorSource : public io::source {
+public:
+  Ns3BufferIteratorSource(ns3::Buffer::Iterator& is)
+    : m_is(is)
+  {
+  }
+
+  std::streamsize
+  read(char* buf, std::streamsize nMaxRead)
+  {
+    std::streamsize i = 0;
+    for (; i < nMaxRead && !m_is.IsEnd(); ++i) {
+      buf[i] = m_is.ReadU8();
+    }
+    if (i == 0) {
+      return -1;
+    }
+    else {
+      return i;
+    }
+  }
+
+private:
+  ns3::Buffer::Iterator& m_is;
+};
+
+/**
+ * Header that decodes using the original stream-based implementation
+ */
+class StreamBlockHeader : public ndn::BlockHeader {
+public:
+  virtual uint32_t
+  Deserialize(ns3::Buffer::Iterator start)
+  {
+    io::stream<Ns3BufferIteratorSource> is(start);
+    getBlock() = ::ndn::Block::fromStream(is);
+    return getBlock().size();
+  }
+};
+
+static int
+run(int argc, char* argv[])
+{
+  size_t nIterations = 100000;
+
+  CommandLine cmd;
+  cmd.AddValue("iterations", "Number of decode operations per block size", nIterations);
+  cmd.Parse(argc, argv);
+
+  std::cout << "BlockSize"
+            << "\t"
+            << "Stream (ns/op)"
+            << "\t"
+            << "Direct (ns/op)"
+            << "\t"
+            << "Speedup"
+            << "\n";
+
+  for (size_t blockSize : {20, 64, 127, 512, 1024, 2048, 4096, 8192}) {
+    // TLV-TYPE (1 octet) + TLV-LENGTH (1 or 3 octets)
+    size_t valueSize = blockSize - (blockSize - 2 < 253 ? 2 : 4);
+    ::ndn::Block block(::ndn::lp::tlv::LpPacket, std::make_shared<::ndn::Buffer>(valueSize));
+    block.encode();
+
+    Ptr<Packet> packet = Create<Packet>();
+    packet->AddHeader(ndn::BlockHeader(block));
+    Ptr<const Packet> p = packet;
+
+    double streamTime = measure(nIterations, [&] (size_t) {
+      Ptr<Packet> copy = p->Copy();
+      StreamBlockHeader header;
+      copy->RemoveHeader(header);
+    });
+
+    double directTime = measure(nIterations, [&] (size_t) {
+      ndn::BlockHeader header;
+      p->PeekHeader(header);
+    });
+
+    std::cout << block.size() << "\t"
+              << streamTime * 1e9 / nIterations << "\t"
+              << directTime * 1e9 / nIterations << "\t"
+              << streamTime / directTime << "\n";
+  }
+
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::run(argc, argv);
+}
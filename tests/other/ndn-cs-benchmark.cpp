@@ -0,0 +1,133 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-cs-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/NFD/daemon/table/cs.hpp"
+#include "ns3/ndnSIM/utils/mem-usage.hpp"
+
+#include "benchmark-common.hpp"
+
+#include <iostream>
+
+namespace ns3 {
+
+/**
+ * Content Store lookup benchmark
+ *
+ * The CS is filled with sequence-numbered Data packets, which are then looked up by Interests
+ * with CanBePrefix=false (served by the exact-match index) and, for reference, by the same
+ * Interests with CanBePrefix=true (served by a scan of the ordered table).  The memory held by
+ * the cached objects is reported as estimated by the CS and as growth of the resident memory.
+ *
+ *     ./waf --run ndn-cs-benchmark --command-template="%s --lookups=1000000"
+ *     ./waf --run ndn-cs-benchmark --command-template="%s --lookups=1000000 --wire-only=1"
+ */
+
+static int
+run(int argc, char* argv[])
+{
+  size_t nLookups = 1000000;
+  bool isWireOnly = false;
+
+  CommandLine cmd;
+  cmd.AddValue("lookups", "Number of lookups per table size", nLookups);
+  cmd.AddValue("wire-only", "Store only the wire encoding of Data packets", isWireOnly);
+  cmd.Parse(argc, argv);
+
+  ::ndn::Signature signature;
+  signature.setInfo(::ndn::SignatureInfo(static_cast< ::ndn::tlv::SignatureTypeValue>(255)));
+  signature.setValue(::ndn::makeNonNegativeIntegerBlock(::ndn::tlv::SignatureValue, 0));
+
+  std::cout << "Objects"
+            << "\t"
+            << "Exact (ns/op)"
+            << "\t"
+            << "Prefix (ns/op)"
+            << "\t"
+            << "Speedup"
+            << "\t"
+            << "Estimated (bytes/entry)"
+            << "\t"
+            << "RSS (bytes/entry)"
+            << "\n";
+
+  for (size_t nObjects : {100000, 1000000}) {
+    double initialMemory = MemUsage::Get();
+
+    nfd::Cs cs(nObjects);
+    cs.enableWireOnly(isWireOnly);
+    for (size_t i = 0; i < nObjects; ++i) {
+      auto data = std::make_shared<ndn::Data>(ndn::Name("/sensor/temperature").appendSequenceNumber(i));
+      data->setFreshnessPeriod(ndn::time::seconds(100));
+      data->setSignature(signature);
+      data->wireEncode();
+      cs.insert(*data);
+    }
+    double memory = MemUsage::Get() - initialMemory;
+
+    std::vector<ndn::Interest> exactInterests;
+    std::vector<ndn::Interest> prefixInterests;
+    exactInterests.reserve(nObjects);
+    prefixInterests.reserve(nObjects);
+    for (size_t i = 0; i < nObjects; ++i) {
+      ndn::Interest interest(ndn::Name("/sensor/temperature").appendSequenceNumber(i));
+      interest.setCanBePrefix(false);
+      exactInterests.push_back(interest);
+      interest.setCanBePrefix(true);
+      prefixInterests.push_back(interest);
+    }
+
+    size_t nHits = 0;
+    auto hit = [&nHits] (const ndn::Interest&, const ndn::Data&) { ++nHits; };
+    auto miss = [] (const ndn::Interest&) {};
+
+    double exactTime = measure(nLookups, [&] (size_t i) {
+      cs.find(exactInterests[(i * 7919) % nObjects], hit, miss);
+    });
+    double prefixTime = measure(nLookups, [&] (size_t i) {
+      cs.find(prefixInterests[(i * 7919) % nObjects], hit, miss);
+    });
+
+    std::cout << nObjects << "\t"
+              << exactTime * 1e9 / nLookups << "\t"
+              << prefixTime * 1e9 / nLookups << "\t"
+              << prefixTime / exactTime << "\t"
+              << cs.getMemoryUsage() / cs.size() << "\t"
+              << memory / nObjects << "\n";
+
+    if (nHits != 2 * nLookups) {
+      std::cerr << "Unexpected misses: " << 2 * nLookups - nHits << std::endl;
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::run(argc, argv);
+}
@@ -0,0 +1,135 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-data-fanout-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/NFD/daemon/face/null-face.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/downstream-collector.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/face-table.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/pit-entry.hpp"
+
+#include "benchmark-common.hpp"
+
+#include <iostream>
+#include <set>
+
+namespace ns3 {
+
+/**
+ * Data fan-out: collecting the downstreams of Data that satisfies several PIT entries
+ *
+ * Data matching 1 to 64 PIT entries is simulated.  Each PIT entry has in-records of a few faces
+ * out of a small set, as with prefix Interests on a broadcast face, so most downstreams are
+ * repeated across entries.  The distinct downstreams are collected with fw::DownstreamCollector
+ * and with std::set, which is how Forwarder::onIncomingData used to work.
+ *
+ *     ./waf --run ndn-data-fanout-benchmark --command-template="%s --iterations=1000000"
+ */
+
+static int
+run(int argc, char* argv[])
+{
+  size_t nIterations = 1000000;
+  size_t nFaces = 16;
+  size_t nInRecords = 3;
+
+  CommandLine cmd;
+  cmd.AddValue("iterations", "Number of Data packets for each number of PIT matches", nIterations);
+  cmd.AddValue("faces", "Number of downstream faces", nFaces);
+  cmd.AddValue("in-records", "Number of in-records of each PIT entry", nInRecords);
+  cmd.Parse(argc, argv);
+
+  nfd::FaceTable faceTable;
+  std::vector<nfd::Face*> faces;
+  for (size_t i = 0; i < nFaces; ++i) {
+    auto face = nfd::face::makeNullFace();
+    faceTable.add(face);
+    faces.push_back(face.get());
+  }
+
+  std::cout << "PIT matches"
+            << "\t"
+            << "Downstreams"
+            << "\t"
+            << "Collector (ns/Data)"
+            << "\t"
+            << "std::set (ns/Data)"
+            << "\n";
+
+  for (size_t nMatches = 1; nMatches <= 64; nMatches *= 2) {
+    std::vector<shared_ptr<nfd::pit::Entry>> pitMatches;
+    for (size_t i = 0; i < nMatches; ++i) {
+      auto interest = make_shared<ndn::Interest>(ndn::Name("/prefix").appendSequenceNumber(i));
+      auto entry = make_shared<nfd::pit::Entry>(*interest);
+      for (size_t j = 0; j < nInRecords; ++j) {
+        entry->insertOrUpdateInRecord(*faces[(i * 7 + j) % nFaces], *interest);
+      }
+      pitMatches.push_back(entry);
+    }
+    auto now = ndn::time::steady_clock::now();
+
+    size_t nCollected = 0;
+    double collectorTime = measure(nIterations, [&] (size_t) {
+      nfd::fw::DownstreamCollector pendingDownstreams;
+      for (const auto& pitEntry : pitMatches) {
+        for (const nfd::pit::InRecord& inRecord : pitEntry->getInRecords()) {
+          if (inRecord.getExpiry() > now) {
+            pendingDownstreams.add(inRecord.getFace());
+          }
+        }
+      }
+      nCollected = pendingDownstreams.size();
+    });
+
+    size_t nSetCollected = 0;
+    double setTime = measure(nIterations, [&] (size_t) {
+      std::set<std::pair<nfd::Face*, nfd::EndpointId>> pendingDownstreams;
+      for (const auto& pitEntry : pitMatches) {
+        for (const nfd::pit::InRecord& inRecord : pitEntry->getInRecords()) {
+          if (inRecord.getExpiry() > now) {
+            pendingDownstreams.emplace(&inRecord.getFace(), 0);
+          }
+        }
+      }
+      nSetCollected = pendingDownstreams.size();
+    });
+
+    std::cout << nMatches << "\t"
+              << nCollected << "\t"
+              << collectorTime * 1e9 / nIterations << "\t"
+              << setTime * 1e9 / nIterations << "\n";
+
+    if (nCollected != nSetCollected) {
+      std::cerr << "Unexpected number of downstreams: " << nCollected << std::endl;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::run(argc, argv);
+}
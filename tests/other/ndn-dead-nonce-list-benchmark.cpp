@@ -0,0 +1,117 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-dead-nonce-list-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/NFD/daemon/table/dead-nonce-list.hpp"
+
+#include <malloc.h>
+#include <iostream>
+
+namespace ns3 {
+
+/**
+ * Dead Nonce List memory per entry, with the hashtable and with the quotient filter
+ *
+ * Entries are added at a constant rate for a number of lifetimes, so that the capacity adapts
+ * to the rate, and the heap used by the Dead Nonce List is then divided by its number of
+ * entries.  The hashtable stores each 64-bit entry in a queue node and in a hashtable node;
+ * the quotient filter stores a slot of remainder + 3 bits and a fingerprint in a packed queue.
+ *
+ *     ./waf --run ndn-dead-nonce-list-benchmark --command-template="%s --rate=1000000"
+ */
+
+static size_t
+getHeapUsage()
+{
+  return mallinfo2().uordblks;
+}
+
+static size_t
+measureBytesPerEntry(double falsePositiveRate, size_t rate, size_t nLifetimes, size_t& nEntries)
+{
+  const size_t nBatchesPerSecond = 1000;
+  const size_t batchSize = std::max<size_t>(rate / nBatchesPerSecond, 1);
+
+  size_t heapBefore = getHeapUsage();
+  auto dnl = std::make_unique<nfd::DeadNonceList>(nfd::time::seconds(1));
+  if (falsePositiveRate > 0.0) {
+    dnl->enableQuotientFilter(falsePositiveRate);
+  }
+
+  uint32_t nonce = 0;
+  for (size_t i = 0; i < nLifetimes * nBatchesPerSecond; ++i) {
+    Simulator::Schedule(MilliSeconds(i), [&] {
+      for (size_t j = 0; j < batchSize; ++j) {
+        ++nonce;
+        dnl->add(static_cast<size_t>(nonce), nonce);
+      }
+    });
+  }
+  Simulator::Stop(Seconds(nLifetimes));
+  Simulator::Run();
+
+  nEntries = dnl->size();
+  size_t bytes = getHeapUsage() - heapBefore;
+  dnl.reset();
+  Simulator::Destroy();
+  return bytes / std::max<size_t>(nEntries, 1);
+}
+
+static int
+run(int argc, char* argv[])
+{
+  size_t rate = 1000000;
+  size_t nLifetimes = 20;
+
+  CommandLine cmd;
+  cmd.AddValue("rate", "Number of entries added per second", rate);
+  cmd.AddValue("lifetimes", "Number of 1-second lifetimes to run", nLifetimes);
+  cmd.Parse(argc, argv);
+
+  std::cout << "Mode"
+            << "\t"
+            << "False positive rate"
+            << "\t"
+            << "Entries"
+            << "\t"
+            << "Memory (bytes/entry)"
+            << "\n";
+
+  for (double falsePositiveRate : {0.0, 0.01, 0.001, 0.0001}) {
+    size_t nEntries = 0;
+    size_t bytesPerEntry = measureBytesPerEntry(falsePositiveRate, rate, nLifetimes, nEntries);
+    std::cout << (falsePositiveRate > 0.0 ? "filter" : "hashtable") << "\t"
+              << falsePositiveRate << "\t"
+              << nEntries << "\t"
+              << bytesPerEntry << "\n";
+  }
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::run(argc, argv);
+}
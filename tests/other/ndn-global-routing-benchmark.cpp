@@ -0,0 +1,196 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-global-routing-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/point-to-point-layout-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+
+#include "benchmark-common.hpp"
+
+#include <iostream>
+
+namespace ns3 {
+
+/**
+ * FIB installation: bulk FibHelper::AddRoutes versus management commands
+ *
+ * Routes to a prefix of every node are computed with GlobalRoutingHelper, which installs them
+ * with FibHelper::AddRoutes.  The installed routes are then removed and installed again, one
+ * signed command Interest per route (FibHelper::AddRoute, which is how GlobalRoutingHelper
+ * used to install them), and finally removed and installed again in bulk.
+ *
+ * The topology is a grid, or is read from an annotated topology file:
+ *
+ *     ./waf --run ndn-global-routing-benchmark --command-template="%s --grid=32"
+ *     ./waf --run ndn-global-routing-benchmark --command-template="%s --all-possible=1 \
+ *       --topology=src/ndnSIM/examples/topologies/topo-abilene.txt"
+ */
+
+static nfd::Fib&
+getFib(Ptr<Node> node)
+{
+  return node->GetObject<ndn::L3Protocol>()->getForwarder()->getFib();
+}
+
+/** \return the routes in the FIB of each node, except those of /localhost prefixes
+ */
+static std::vector<std::vector<ndn::FibHelper::Route>>
+collectRoutes(const NodeContainer& nodes)
+{
+  std::vector<std::vector<ndn::FibHelper::Route>> routes(nodes.GetN());
+  for (uint32_t i = 0; i < nodes.GetN(); ++i) {
+    for (const auto& entry : getFib(nodes.Get(i))) {
+      if (ndn::Name("/localhost").isPrefixOf(entry.getPrefix())) {
+        continue;
+      }
+      for (const auto& nextHop : entry.getNextHops()) {
+        routes[i].push_back({entry.getPrefix(), nextHop.getFace().shared_from_this(),
+                             static_cast<int32_t>(nextHop.getCost())});
+      }
+    }
+  }
+  return routes;
+}
+
+static size_t
+countRoutes(const std::vector<std::vector<ndn::FibHelper::Route>>& routes)
+{
+  size_t nRoutes = 0;
+  for (const auto& nodeRoutes : routes) {
+    nRoutes += nodeRoutes.size();
+  }
+  return nRoutes;
+}
+
+static void
+eraseRoutes(const NodeContainer& nodes,
+            const std::vector<std::vector<ndn::FibHelper::Route>>& routes)
+{
+  for (uint32_t i = 0; i < nodes.GetN(); ++i) {
+    for (const auto& route : routes[i]) {
+      getFib(nodes.Get(i)).erase(route.prefix);
+    }
+  }
+}
+
+static int
+run(int argc, char* argv[])
+{
+  uint32_t gridSize = 32;
+  std::string topology;
+  bool isAllPossible = false;
+
+  CommandLine cmd;
+  cmd.AddValue("grid", "Width and height of the grid topology", gridSize);
+  cmd.AddValue("topology", "Annotated topology file, used instead of the grid", topology);
+  cmd.AddValue("all-possible", "Use CalculateAllPossibleRoutes instead of CalculateRoutes",
+               isAllPossible);
+  cmd.Parse(argc, argv);
+
+  PointToPointHelper p2p;
+  std::unique_ptr<PointToPointGridHelper> grid;
+  AnnotatedTopologyReader topologyReader("", 25);
+  if (topology.empty()) {
+    grid.reset(new PointToPointGridHelper(gridSize, gridSize, p2p));
+  }
+  else {
+    topologyReader.SetFileName(topology);
+    topologyReader.Read();
+  }
+  NodeContainer nodes = NodeContainer::GetGlobal();
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.InstallAll();
+
+  ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+  ndnGlobalRoutingHelper.InstallAll();
+  for (uint32_t i = 0; i < nodes.GetN(); ++i) {
+    ndnGlobalRoutingHelper.AddOrigin("/node" + std::to_string(i), nodes.Get(i));
+  }
+
+  double calculateTime = measure(1, [&] (size_t) {
+    if (isAllPossible) {
+      ndn::GlobalRoutingHelper::CalculateAllPossibleRoutes();
+    }
+    else {
+      ndn::GlobalRoutingHelper::CalculateRoutes();
+    }
+  });
+
+  auto routes = collectRoutes(nodes);
+  size_t nRoutes = countRoutes(routes);
+
+  eraseRoutes(nodes, routes);
+  double commandTime = measure(1, [&] (size_t) {
+    for (uint32_t i = 0; i < nodes.GetN(); ++i) {
+      for (const auto& route : routes[i]) {
+        ndn::FibHelper::AddRoute(nodes.Get(i), route.prefix, route.face, route.metric);
+      }
+    }
+    ndn::StackHelper::ProcessWarmupEvents();
+  });
+  size_t nCommandRoutes = countRoutes(collectRoutes(nodes));
+
+  eraseRoutes(nodes, routes);
+  double bulkTime = measure(1, [&] (size_t) {
+    for (uint32_t i = 0; i < nodes.GetN(); ++i) {
+      ndn::FibHelper::AddRoutes(nodes.Get(i), routes[i]);
+    }
+  });
+  size_t nBulkRoutes = countRoutes(collectRoutes(nodes));
+
+  std::cout << "Nodes"
+            << "\t"
+            << "Routes"
+            << "\t"
+            << "Calculate+install (ms)"
+            << "\t"
+            << "Commands (ns/route)"
+            << "\t"
+            << "Bulk (ns/route)"
+            << "\n";
+  std::cout << nodes.GetN() << "\t"
+            << nRoutes << "\t"
+            << calculateTime * 1e3 << "\t"
+            << commandTime * 1e9 / nRoutes << "\t"
+            << bulkTime * 1e9 / nRoutes << "\n";
+
+  Simulator::Destroy();
+
+  if (nCommandRoutes != nRoutes || nBulkRoutes != nRoutes) {
+    std::cerr << "Unexpected number of installed routes: " << nCommandRoutes << ", "
+              << nBulkRoutes << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::run(argc, argv);
+}
@@ -0,0 +1,134 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-lp-fragmentation-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/NFD/daemon/face/lp-fragmenter.hpp"
+#include "ns3/ndnSIM/NFD/daemon/face/lp-reassembler.hpp"
+
+#include "benchmark-common.hpp"
+
+#include <iostream>
+
+namespace ns3 {
+
+/**
+ * NDNLPv2 fragmentation and reassembly throughput at an LR-WPAN MTU
+ *
+ * Data packets of a given payload size are fragmented for an MTU of 102 octets (114 octets of
+ * an LR-WPAN frame, less the room kept for a congestion mark), with HopCount and GeoTag
+ * headers, and the fragments are then reassembled.  Both run within one simulator event.
+ *
+ *     ./waf --run ndn-lp-fragmentation-benchmark --command-template="%s --payload=500"
+ */
+
+static int
+run(int argc, char* argv[])
+{
+  size_t nPackets = 100000;
+  size_t payloadSize = 500;
+  size_t mtu = 102;
+  bool isOverheadBoundByMtu = false;
+
+  CommandLine cmd;
+  cmd.AddValue("packets", "Number of packets", nPackets);
+  cmd.AddValue("payload", "Payload size of Data packets", payloadSize);
+  cmd.AddValue("mtu", "MTU available to NDNLPv2", mtu);
+  cmd.AddValue("mtu-bound-overhead", "Reserve only the fragment overhead bound by the MTU",
+               isOverheadBoundByMtu);
+  cmd.Parse(argc, argv);
+
+  auto data = make_shared<ndn::Data>(ndn::Name("/prefix/data"));
+  data->setContent(std::vector<uint8_t>(payloadSize, 0xBB));
+  ndn::StackHelper::getKeyChain().sign(*data);
+
+  std::vector<ndn::lp::Packet> packets(nPackets);
+  for (size_t i = 0; i < nPackets; ++i) {
+    packets[i] = ndn::lp::Packet(data->wireEncode());
+    packets[i].add<ndn::lp::HopCountTagField>(i % 10);
+    packets[i].add<ndn::lp::GeoTagField>(ndn::lp::GeoTag());
+  }
+
+  ::nfd::face::LpFragmenter::Options fragmenterOptions;
+  fragmenterOptions.isOverheadBoundByMtu = isOverheadBoundByMtu;
+  ::nfd::face::LpFragmenter fragmenter(fragmenterOptions);
+  ::nfd::face::LpReassembler reassembler({});
+
+  std::vector<std::vector<ndn::lp::Packet>> frags(nPackets);
+  size_t nFragments = 0;
+  size_t nReassembled = 0;
+  double fragmentTime = 0;
+  double reassembleTime = 0;
+  Simulator::Schedule(Seconds(1), [&] {
+    fragmentTime = measure(nPackets, [&] (size_t i) {
+      std::tie(std::ignore, frags[i]) = fragmenter.fragmentPacket(packets[i], mtu, i * 1000);
+    });
+
+    // as received, the fragments are parsed from their wire encoding
+    for (auto& packetFrags : frags) {
+      for (auto& frag : packetFrags) {
+        frag = ndn::lp::Packet(frag.wireEncode());
+      }
+      nFragments += packetFrags.size();
+    }
+
+    reassembleTime = measure(nPackets, [&] (size_t i) {
+      for (const auto& frag : frags[i]) {
+        nReassembled += std::get<0>(reassembler.receiveFragment(0, frag));
+      }
+    });
+  });
+
+  Simulator::Stop(Seconds(2));
+  Simulator::Run();
+  Simulator::Destroy();
+
+  std::cout << "Packets"
+            << "\t"
+            << "Size"
+            << "\t"
+            << "Fragments per packet"
+            << "\t"
+            << "Fragment (ns/packet)"
+            << "\t"
+            << "Reassemble (ns/packet)"
+            << "\n";
+  std::cout << nPackets << "\t"
+            << data->wireEncode().size() << "\t"
+            << static_cast<double>(nFragments) / nPackets << "\t"
+            << fragmentTime * 1e9 / nPackets << "\t"
+            << reassembleTime * 1e9 / nPackets << "\n";
+
+  if (nReassembled != nPackets) {
+    std::cerr << "Unexpected number of reassembled packets: " << nReassembled << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::run(argc, argv);
+}
@@ -0,0 +1,201 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-lr-wpan-grid-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/lr-wpan-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/model/ndn-block-header.hpp"
+#include "ns3/ndnSIM/utils/mem-usage.hpp"
+
+#include <cmath>
+#include <sys/time.h>
+
+namespace ns3 {
+
+/**
+ * Broadcast load benchmark: NDN over a square grid of LR-WPAN nodes
+ *
+ * A consumer in one corner of the grid requests data from a producer in the opposite corner,
+ * every node re-broadcasts on its AD_HOC face.  Real (wall-clock) time, number of packets
+ * processed by all forwarders, NDNLPv2 bytes and frames sent per network-layer packet, and
+ * resident memory are reported at the end.
+ *
+ *     ./waf --run ndn-lr-wpan-grid-benchmark --command-template="%s --nodes=500 --shared-wire=0"
+ *     ./waf --run ndn-lr-wpan-grid-benchmark --command-template="%s --nodes=500 --shared-wire=1"
+ *     ./waf --run ndn-lr-wpan-grid-benchmark --command-template="%s --nodes=500 --spatial-grid=1"
+ *     ./waf --run ndn-lr-wpan-grid-benchmark --command-template="%s --nodes=500 --compact-lp=1"
+ */
+
+class LrWpanGridBenchmark {
+public:
+  int
+  run(int argc, char* argv[]);
+
+private:
+  static double
+  now();
+
+  void
+  printStats(std::ostream& os, double beginRealTime, double initialMemory);
+
+private:
+  uint32_t m_nNodes = 500;
+  double m_spacing = 20.0;
+  double m_interestRate = 1.0;
+  uint32_t m_payloadSize = 50;
+  bool m_shouldShareWire = true;
+  bool m_shouldUseSpatialGrid = false;
+  bool m_isCompactLp = false;
+  std::string m_strategy = "/localhost/nfd/strategy/multicast";
+  Time m_simulationTime = Seconds(60);
+  NetDeviceContainer m_devices;
+};
+
+double
+LrWpanGridBenchmark::now()
+{
+  ::timeval t;
+  gettimeofday(&t, NULL);
+  return t.tv_sec + (0.000001 * (unsigned)t.tv_usec);
+}
+
+void
+LrWpanGridBenchmark::printStats(std::ostream& os, double beginRealTime, double initialMemory)
+{
+  double realTime = now() - beginRealTime;
+
+  uint64_t nInInterests = 0;
+  uint64_t nInData = 0;
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    const auto& counters = (*node)->GetObject<ndn::L3Protocol>()->getForwarder()->getCounters();
+    nInInterests += counters.nInInterests;
+    nInData += counters.nInData;
+  }
+
+  uint64_t nOutNetPackets = 0;
+  uint64_t nOutFrames = 0;
+  uint64_t nOutBytes = 0;
+  for (auto device = m_devices.Begin(); device != m_devices.End(); ++device) {
+    auto ndn = (*device)->GetNode()->GetObject<ndn::L3Protocol>();
+    const auto& counters = ndn->getFaceByNetDevice(*device)->getCounters();
+    nOutNetPackets += counters.nOutInterests + counters.nOutData + counters.nOutNacks;
+    nOutFrames += counters.nOutPackets;
+    nOutBytes += counters.nOutBytes;
+  }
+
+  os << "Nodes" << "\t" << m_nNodes << "\n"
+     << "SharedWire" << "\t" << m_shouldShareWire << "\n"
+     << "SpatialGrid" << "\t" << m_shouldUseSpatialGrid << "\n"
+     << "CompactLp" << "\t" << m_isCompactLp << "\n"
+     << "RealTime (s)" << "\t" << realTime << "\n"
+     << "InInterests" << "\t" << nInInterests << "\n"
+     << "InData" << "\t" << nInData << "\n"
+     << "Packets per real second" << "\t" << (nInInterests + nInData) / realTime << "\n"
+     << "OutNetPackets" << "\t" << nOutNetPackets << "\n"
+     << "LP bytes per packet" << "\t" << static_cast<double>(nOutBytes) / nOutNetPackets << "\n"
+     << "Frames per packet" << "\t" << static_cast<double>(nOutFrames) / nOutNetPackets << "\n"
+     << "Memory (MiB)" << "\t" << MemUsage::Get() / 1024.0 / 1024.0 << "\n"
+     << "Memory growth (MiB)" << "\t"
+     << MemUsage::Get() / 1024.0 / 1024.0 - initialMemory << "\n";
+}
+
+int
+LrWpanGridBenchmark::run(int argc, char* argv[])
+{
+  CommandLine cmd;
+  cmd.AddValue("nodes", "Number of nodes in the grid", m_nNodes);
+  cmd.AddValue("spacing", "Distance between neighbouring grid nodes (m)", m_spacing);
+  cmd.AddValue("rate", "Interest rate of the consumer", m_interestRate);
+  cmd.AddValue("payload", "Payload size of Data packets", m_payloadSize);
+  cmd.AddValue("shared-wire", "Share the encoded block between receivers of a transmission",
+               m_shouldShareWire);
+  cmd.AddValue("spatial-grid", "Only deliver transmissions to the nodes within reach",
+               m_shouldUseSpatialGrid);
+  cmd.AddValue("compact-lp", "Use compact NDNLPv2 headers, with /prefix as Name context",
+               m_isCompactLp);
+  cmd.AddValue("strategy", "Forwarding strategy", m_strategy);
+  cmd.AddValue("sim-time", "Simulation time", m_simulationTime);
+  cmd.Parse(argc, argv);
+
+  ndn::BlockHeader::setSharedWireCapacity(m_shouldShareWire ? 1024 : 0);
+
+  double initialMemory = MemUsage::Get() / 1024.0 / 1024.0;
+
+  NodeContainer nodes;
+  nodes.Create(m_nNodes);
+
+  uint32_t gridWidth = static_cast<uint32_t>(std::ceil(std::sqrt(m_nNodes)));
+  MobilityHelper mobility;
+  mobility.SetPositionAllocator("ns3::GridPositionAllocator",
+                                "MinX", DoubleValue(0.0), "MinY", DoubleValue(0.0),
+                                "DeltaX", DoubleValue(m_spacing), "DeltaY", DoubleValue(m_spacing),
+                                "GridWidth", UintegerValue(gridWidth),
+                                "LayoutType", StringValue("RowFirst"));
+  mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+  mobility.Install(nodes);
+
+  LrWpanHelper lrWpanHelper;
+  if (m_shouldUseSpatialGrid) {
+    lrWpanHelper.EnableSpatialGrid();
+  }
+  m_devices = lrWpanHelper.Install(nodes);
+  lrWpanHelper.AssociateToPan(m_devices, 0);
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.SetDefaultRoutes(true);
+  ndnHelper.setCompactLp(m_isCompactLp, {"/prefix"});
+  ndnHelper.InstallAll();
+
+  ndn::StrategyChoiceHelper::InstallAll("/", m_strategy);
+
+  ndn::AppHelper consumerHelper("ns3::ndn::ConsumerCbr");
+  consumerHelper.SetPrefix("/prefix");
+  consumerHelper.SetAttribute("Frequency", DoubleValue(m_interestRate));
+  consumerHelper.Install(nodes.Get(0));
+
+  ndn::AppHelper producerHelper("ns3::ndn::Producer");
+  producerHelper.SetPrefix("/prefix");
+  producerHelper.SetAttribute("PayloadSize", UintegerValue(m_payloadSize));
+  producerHelper.Install(nodes.Get(m_nNodes - 1));
+
+  Simulator::Stop(m_simulationTime);
+
+  double beginRealTime = now();
+  Simulator::Schedule(m_simulationTime - NanoSeconds(1), &LrWpanGridBenchmark::printStats, this,
+                      std::ref(std::cout), beginRealTime, initialMemory);
+
+  Simulator::Run();
+  Simulator::Destroy();
+
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  ns3::LrWpanGridBenchmark benchmark;
+  return benchmark.run(argc, argv);
+}
@@ -0,0 +1,136 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-name-tree-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/NFD/daemon/table/name-tree.hpp"
+
+#include "benchmark-common.hpp"
+
+#include <iostream>
+
+namespace ns3 {
+
+/**
+ * NameTree hashtable layouts: chained buckets versus open addressing
+ *
+ * For each number of names from 10^4 to --max-names, names /prefix/<i>/<seq> are inserted
+ * (with their ancestors), looked up (existing and absent names), and erased.  The hashes are
+ * computed in advance, as the forwarder computes them once per packet.
+ *
+ *     ./waf --run ndn-name-tree-benchmark --command-template="%s --max-names=10000000"
+ */
+
+/** \return whether the NameTree behaved as expected
+ */
+static bool
+runLayout(size_t nNames, nfd::name_tree::HashtableLayout layout)
+{
+  std::vector<ndn::Name> names;
+  std::vector<nfd::name_tree::HashSequence> hashes;
+  names.reserve(nNames);
+  hashes.reserve(nNames);
+  for (size_t i = 0; i < nNames; ++i) {
+    names.push_back(ndn::Name("/prefix").appendNumber(i % 1000).appendSequenceNumber(i));
+    hashes.push_back(nfd::name_tree::computeHashes(names.back()));
+  }
+  std::vector<ndn::Name> absentNames;
+  absentNames.reserve(nNames);
+  for (size_t i = 0; i < nNames; ++i) {
+    absentNames.push_back(ndn::Name("/absent").appendSequenceNumber(i));
+  }
+
+  nfd::NameTree nameTree(1024, layout);
+  std::vector<nfd::name_tree::Entry*> entries(nNames);
+
+  double insertTime = measure(nNames, [&] (size_t i) {
+    entries[i] = &nameTree.lookup(names[i], names[i].size(), hashes[i]);
+  });
+  size_t nBuckets = nameTree.getNBuckets();
+
+  size_t nFound = 0;
+  double lookupTime = measure(nNames, [&] (size_t i) {
+    nFound += nameTree.findLongestPrefixMatch(names[i], hashes[i]) == entries[i];
+  });
+  double missTime = measure(nNames, [&] (size_t i) {
+    nFound += nameTree.findExactMatch(absentNames[i]) != nullptr;
+  });
+
+  double eraseTime = measure(nNames, [&] (size_t i) {
+    nameTree.eraseIfEmpty(entries[i]);
+  });
+
+  std::cout << nNames << "\t"
+            << layout << "\t"
+            << nBuckets << "\t"
+            << insertTime * 1e9 / nNames << "\t"
+            << lookupTime * 1e9 / nNames << "\t"
+            << missTime * 1e9 / nNames << "\t"
+            << eraseTime * 1e9 / nNames << "\n";
+
+  if (nFound != nNames || nameTree.size() != 0) {
+    std::cerr << "Unexpected NameTree state: found=" << nFound
+              << " size=" << nameTree.size() << std::endl;
+    return false;
+  }
+  return true;
+}
+
+static int
+run(int argc, char* argv[])
+{
+  size_t maxNames = 1000000;
+
+  CommandLine cmd;
+  cmd.AddValue("max-names", "Largest number of names, from 10000", maxNames);
+  cmd.Parse(argc, argv);
+
+  std::cout << "Names"
+            << "\t"
+            << "Layout"
+            << "\t"
+            << "Buckets"
+            << "\t"
+            << "Insert (ns/op)"
+            << "\t"
+            << "Lookup (ns/op)"
+            << "\t"
+            << "Absent lookup (ns/op)"
+            << "\t"
+            << "Erase (ns/op)"
+            << "\n";
+
+  bool isOk = true;
+  for (size_t nNames = 10000; nNames <= maxNames; nNames *= 10) {
+    isOk = runLayout(nNames, nfd::name_tree::HashtableLayout::CHAINED) && isOk;
+    isOk = runLayout(nNames, nfd::name_tree::HashtableLayout::OPEN_ADDRESSING) && isOk;
+  }
+  return isOk ? 0 : 1;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::run(argc, argv);
+}
@@ -0,0 +1,98 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-name-tree-expiry-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/NFD/daemon/table/dmif-table.hpp"
+
+#include "benchmark-common.hpp"
+
+#include <iostream>
+
+namespace ns3 {
+
+/**
+ * Cost of the periodic DMIF expiry check versus the size of the DMIF table
+ *
+ * The table is filled with a number of records.  The check is timed while none of the records
+ * has expired, which should not depend on the table size, and once after all of them have
+ * expired, which should be proportional to the number of records.
+ *
+ *     ./waf --run ndn-name-tree-expiry-benchmark --command-template="%s --iterations=100"
+ */
+
+static int
+run(int argc, char* argv[])
+{
+  size_t nIterations = 100;
+
+  CommandLine cmd;
+  cmd.AddValue("iterations", "Number of checks without expired records", nIterations);
+  cmd.Parse(argc, argv);
+
+  std::cout << "Records"
+            << "\t"
+            << "Check, none expired (ns/op)"
+            << "\t"
+            << "Check, all expired (ns/record)"
+            << "\n";
+
+  for (size_t nRecords : {1000, 10000, 100000, 1000000}) {
+    auto table = ndn::make_unique<nfd::DmifTable>();
+
+    for (size_t i = 0; i < nRecords; ++i) {
+      table->findOrInsert(ndn::Name("/record").appendNumber(i), 1, true, true, 1);
+    }
+
+    double noneExpiredTime = 0;
+    Simulator::Schedule(Seconds(1), [&] {
+      noneExpiredTime = measure(nIterations, [&] (size_t) { table->checkExpired(); });
+    });
+
+    // records are inserted at 0s and expire after DMIF_DELAY, just before the check that was
+    // scheduled by the first insertion
+    double allExpiredTime = 0;
+    Simulator::Schedule(MilliSeconds(nfd::DmifTable::DMIF_DELAY), [&] {
+      allExpiredTime = measure(1, [&] (size_t) { table->checkExpired(); });
+    });
+
+    Simulator::Stop(MilliSeconds(nfd::DmifTable::DMIF_DELAY) + Seconds(1));
+    Simulator::Run();
+
+    std::cout << nRecords << "\t"
+              << noneExpiredTime * 1e9 / nIterations << "\t"
+              << allExpiredTime * 1e9 / nRecords << "\n";
+
+    table.reset();
+    Simulator::Destroy();
+  }
+
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::run(argc, argv);
+}
@@ -0,0 +1,136 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-pit-churn-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/NFD/daemon/face/null-face.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/face-table.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/pit.hpp"
+
+#include "benchmark-common.hpp"
+
+#include <iostream>
+
+namespace ns3 {
+
+/**
+ * PIT churn: creating PIT entries with in-records and out-records, and satisfying them
+ *
+ * A number of PIT entries are inserted, and each gets in-records and out-records of 1 to 4
+ * faces, as the incoming and outgoing Interest pipelines do.  The entries are then satisfied:
+ * the records are looked up, as the incoming Data pipeline and the strategies do, and the
+ * entries are erased.  With a single record, the in-record and the out-record are on the same
+ * face, as with an ad hoc wireless face.
+ *
+ *     ./waf --run ndn-pit-churn-benchmark --command-template="%s --entries=1000000"
+ */
+
+static int
+run(int argc, char* argv[])
+{
+  size_t nEntries = 1000000;
+  size_t nFaces = 16;
+
+  CommandLine cmd;
+  cmd.AddValue("entries", "Number of PIT entries", nEntries);
+  cmd.AddValue("faces", "Number of faces", nFaces);
+  cmd.Parse(argc, argv);
+
+  nfd::FaceTable faceTable;
+  std::vector<nfd::Face*> faces;
+  for (size_t i = 0; i < nFaces; ++i) {
+    auto face = nfd::face::makeNullFace();
+    faceTable.add(face);
+    faces.push_back(face.get());
+  }
+
+  std::vector<shared_ptr<ndn::Interest>> interests;
+  interests.reserve(nEntries);
+  for (size_t i = 0; i < nEntries; ++i) {
+    interests.push_back(make_shared<ndn::Interest>(ndn::Name("/prefix").appendSequenceNumber(i)));
+  }
+
+  std::cout << "Entries"
+            << "\t"
+            << "Records"
+            << "\t"
+            << "Insert records (ns/entry)"
+            << "\t"
+            << "Find records (ns/entry)"
+            << "\t"
+            << "Insert+erase entry (ns/entry)"
+            << "\n";
+
+  for (size_t nRecords = 1; nRecords <= 4; nRecords *= 2) {
+    nfd::NameTree nameTree;
+    nfd::Pit pit(nameTree);
+    std::vector<shared_ptr<nfd::pit::Entry>> entries(nEntries);
+    auto getInFace = [&] (size_t i, size_t j) -> nfd::Face& {
+      return *faces[(i + j) % nFaces];
+    };
+    auto getOutFace = [&] (size_t i, size_t j) -> nfd::Face& {
+      return *faces[(i + j + (nRecords > 1 ? nRecords : 0)) % nFaces];
+    };
+
+    double insertTime = measure(nEntries, [&] (size_t i) {
+      entries[i] = pit.insert(*interests[i]).first;
+    });
+    double insertRecordsTime = measure(nEntries, [&] (size_t i) {
+      for (size_t j = 0; j < nRecords; ++j) {
+        entries[i]->insertOrUpdateInRecord(getInFace(i, j), *interests[i]);
+        entries[i]->insertOrUpdateOutRecord(getOutFace(i, j), *interests[i]);
+      }
+    });
+
+    size_t nFound = 0;
+    double findRecordsTime = measure(nEntries, [&] (size_t i) {
+      for (size_t j = 0; j < nRecords; ++j) {
+        nFound += entries[i]->getInRecord(getInFace(i, j)) != entries[i]->in_end();
+        nFound += entries[i]->getOutRecord(getOutFace(i, j)) != entries[i]->out_end();
+      }
+    });
+    double eraseTime = measure(nEntries, [&] (size_t i) {
+      pit.erase(entries[i].get());
+      entries[i].reset();
+    });
+
+    std::cout << nEntries << "\t"
+              << nRecords << "\t"
+              << insertRecordsTime * 1e9 / nEntries << "\t"
+              << findRecordsTime * 1e9 / nEntries << "\t"
+              << (insertTime + eraseTime) * 1e9 / nEntries << "\n";
+
+    if (nFound != 2 * nRecords * nEntries || pit.size() != 0) {
+      std::cerr << "Unexpected number of records: " << nFound << std::endl;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::run(argc, argv);
+}
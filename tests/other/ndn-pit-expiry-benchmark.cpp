@@ -0,0 +1,150 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-pit-expiry-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/NFD/daemon/common/global.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/pit-entry.hpp"
+
+#include "benchmark-common.hpp"
+
+#include <iostream>
+
+namespace ns3 {
+
+/**
+ * PIT expiry timers: timing wheel versus ndn::Scheduler
+ *
+ * A number of PIT entries get an expiry timer of 100ms to 4s.  The timers are started, then
+ * restarted (as for a retransmitted Interest), and finally left to fire.  The same is done with
+ * ndn::Scheduler events, which is how Forwarder::setExpiryTimer used to work.
+ *
+ *     ./waf --run ndn-pit-expiry-benchmark --command-template="%s --entries=1000000"
+ */
+
+static ndn::time::milliseconds
+getDuration(size_t i)
+{
+  return ndn::time::milliseconds(100 + (i * 7919) % 3900);
+}
+
+/** \return run time of the simulation, in seconds, not including \p setupTime spent in
+ *          the scheduled setup event
+ */
+static double
+runSimulation(double setupTime)
+{
+  Simulator::Stop(Seconds(10));
+  double time = measure(1, [] (size_t) { Simulator::Run(); });
+  Simulator::Destroy();
+  return time - setupTime;
+}
+
+static int
+run(int argc, char* argv[])
+{
+  size_t nEntries = 1000000;
+
+  CommandLine cmd;
+  cmd.AddValue("entries", "Number of PIT entries", nEntries);
+  cmd.Parse(argc, argv);
+
+  std::vector<shared_ptr<nfd::pit::Entry>> entries;
+  entries.reserve(nEntries);
+  for (size_t i = 0; i < nEntries; ++i) {
+    entries.push_back(make_shared<nfd::pit::Entry>(
+      *make_shared<ndn::Interest>(ndn::Name("/prefix").appendSequenceNumber(i))));
+  }
+
+  std::cout << "Timers"
+            << "\t"
+            << "Implementation"
+            << "\t"
+            << "Schedule (ns/op)"
+            << "\t"
+            << "Reschedule (ns/op)"
+            << "\t"
+            << "Fire (ns/op)"
+            << "\n";
+
+  size_t nFired = 0;
+  double scheduleTime = 0;
+  double rescheduleTime = 0;
+  double fireTime = 0;
+
+  {
+    nfd::pit::ExpiryWheel wheel([&nFired] (const shared_ptr<nfd::pit::Entry>&) { ++nFired; });
+    Simulator::Schedule(Seconds(1), [&] {
+      scheduleTime = measure(nEntries, [&] (size_t i) {
+        wheel.schedule(entries[i]->expiryTimer, entries[i], getDuration(i));
+      });
+      rescheduleTime = measure(nEntries, [&] (size_t i) {
+        wheel.schedule(entries[i]->expiryTimer, entries[i], getDuration(i + 1));
+      });
+    });
+    fireTime = runSimulation(scheduleTime + rescheduleTime);
+  }
+  std::cout << nEntries << "\t"
+            << "wheel"
+            << "\t"
+            << scheduleTime * 1e9 / nEntries << "\t"
+            << rescheduleTime * 1e9 / nEntries << "\t"
+            << fireTime * 1e9 / nEntries << "\n";
+
+  {
+    std::vector<ndn::scheduler::EventId> eventIds(nEntries);
+    auto onExpiry = [&nFired] (const shared_ptr<nfd::pit::Entry>&) { ++nFired; };
+    Simulator::Schedule(Seconds(1), [&] {
+      scheduleTime = measure(nEntries, [&] (size_t i) {
+        auto entry = entries[i];
+        eventIds[i] = nfd::getScheduler().schedule(getDuration(i), [=] { onExpiry(entry); });
+      });
+      rescheduleTime = measure(nEntries, [&] (size_t i) {
+        auto entry = entries[i];
+        eventIds[i].cancel();
+        eventIds[i] = nfd::getScheduler().schedule(getDuration(i + 1), [=] { onExpiry(entry); });
+      });
+    });
+    fireTime = runSimulation(scheduleTime + rescheduleTime);
+    nfd::resetGlobalScheduler();
+  }
+  std::cout << nEntries << "\t"
+            << "scheduler"
+            << "\t"
+            << scheduleTime * 1e9 / nEntries << "\t"
+            << rescheduleTime * 1e9 / nEntries << "\t"
+            << fireTime * 1e9 / nEntries << "\n";
+
+  if (nFired != 2 * nEntries) {
+    std::cerr << "Unexpected number of fired timers: " << nFired << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::run(argc, argv);
+}
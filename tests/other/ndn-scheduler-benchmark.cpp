@@ -0,0 +1,118 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-scheduler-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "benchmark-common.hpp"
+
+#include <ndn-cxx/util/scheduler.hpp>
+
+#include <iostream>
+
+namespace ns3 {
+
+/**
+ * ndn::Scheduler throughput
+ *
+ * A number of timers of 10ms to 10s are scheduled and canceled.  They are then scheduled
+ * again, half of them are rescheduled (cancel, then schedule with another delay), and all
+ * are left to fire.  Operations that do not fire run within one simulator event.
+ *
+ *     ./waf --run ndn-scheduler-benchmark --command-template="%s --timers=1000000"
+ */
+
+static ndn::time::milliseconds
+getDelay(size_t i)
+{
+  return ndn::time::milliseconds(10 + (i * 7919) % 9990);
+}
+
+static int
+run(int argc, char* argv[])
+{
+  size_t nTimers = 1000000;
+
+  CommandLine cmd;
+  cmd.AddValue("timers", "Number of timers", nTimers);
+  cmd.Parse(argc, argv);
+
+  ndn::DummyIoService io;
+  ndn::Scheduler scheduler(io);
+  std::vector<ndn::scheduler::EventId> eventIds(nTimers);
+  size_t nFired = 0;
+  auto onFire = [&nFired] { ++nFired; };
+
+  double scheduleTime = 0;
+  double cancelTime = 0;
+  double rescheduleTime = 0;
+  Simulator::Schedule(Seconds(1), [&] {
+    scheduleTime = measure(nTimers, [&] (size_t i) {
+      eventIds[i] = scheduler.schedule(getDelay(i), onFire);
+    });
+    cancelTime = measure(nTimers, [&] (size_t i) {
+      eventIds[i].cancel();
+    });
+
+    for (size_t i = 0; i < nTimers; ++i) {
+      eventIds[i] = scheduler.schedule(getDelay(i), onFire);
+    }
+    rescheduleTime = measure(nTimers / 2, [&] (size_t i) {
+      eventIds[i * 2].cancel();
+      eventIds[i * 2] = scheduler.schedule(getDelay(i + 1), onFire);
+    });
+  });
+
+  Simulator::Stop(Seconds(20));
+  double runTime = measure(1, [] (size_t) { Simulator::Run(); });
+  double fireTime = runTime - scheduleTime - cancelTime - rescheduleTime;
+  Simulator::Destroy();
+
+  std::cout << "Timers"
+            << "\t"
+            << "Schedule (ns/op)"
+            << "\t"
+            << "Cancel (ns/op)"
+            << "\t"
+            << "Reschedule (ns/op)"
+            << "\t"
+            << "Schedule+fire (ns/op)"
+            << "\n";
+  std::cout << nTimers << "\t"
+            << scheduleTime * 1e9 / nTimers << "\t"
+            << cancelTime * 1e9 / nTimers << "\t"
+            << rescheduleTime * 1e9 / (nTimers / 2) << "\t"
+            << fireTime * 1e9 / nTimers << "\n";
+
+  if (nFired != nTimers) {
+    std::cerr << "Unexpected number of fired timers: " << nFired << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::run(argc, argv);
+}
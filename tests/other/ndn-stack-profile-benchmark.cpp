@@ -0,0 +1,110 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-stack-profile-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/lr-wpan-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/utils/mem-usage.hpp"
+
+#include "benchmark-common.hpp"
+
+#include <iostream>
+
+namespace ns3 {
+
+/**
+ * Startup cost of the NDN stack: full versus minimal NFD profile
+ *
+ * The NDN stack is installed on a number of LR-WPAN nodes, with default routes and a
+ * strategy choice as in ndn-lr-wpan-grid-benchmark.  The time taken to install it and the
+ * growth of resident memory are reported.  Each profile should be measured in its own run:
+ *
+ *     ./waf --run ndn-stack-profile-benchmark --command-template="%s --nodes=5000 --minimal=0"
+ *     ./waf --run ndn-stack-profile-benchmark --command-template="%s --nodes=5000 --minimal=1"
+ */
+
+static int
+run(int argc, char* argv[])
+{
+  uint32_t nNodes = 5000;
+  bool isMinimal = false;
+
+  CommandLine cmd;
+  cmd.AddValue("nodes", "Number of nodes", nNodes);
+  cmd.AddValue("minimal", "Use the minimal NFD profile", isMinimal);
+  cmd.Parse(argc, argv);
+
+  NodeContainer nodes;
+  nodes.Create(nNodes);
+
+  LrWpanHelper lrWpanHelper;
+  NetDeviceContainer devices = lrWpanHelper.Install(nodes);
+  lrWpanHelper.AssociateToPan(devices, 0);
+
+  // the key chain is shared by all nodes, and is created before measuring
+  ndn::StackHelper::getKeyChain();
+
+  double initialMemory = MemUsage::Get() / 1024.0 / 1024.0;
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.SetDefaultRoutes(true);
+  ndnHelper.setMinimalProfile(isMinimal);
+  double installTime = measure(1, [&] (size_t) {
+    ndnHelper.Install(nodes);
+    ndn::StrategyChoiceHelper::Install(nodes, "/", "/localhost/nfd/strategy/multicast");
+    Simulator::Stop(Seconds(1));
+    Simulator::Run();
+  });
+
+  double memoryGrowth = MemUsage::Get() / 1024.0 / 1024.0 - initialMemory;
+
+  std::cout << "Nodes"
+            << "\t"
+            << "Profile"
+            << "\t"
+            << "Install (ms)"
+            << "\t"
+            << "Install per node (us)"
+            << "\t"
+            << "Memory growth (MiB)"
+            << "\t"
+            << "Memory per node (KiB)"
+            << "\n";
+  std::cout << nNodes << "\t"
+            << (isMinimal ? "minimal" : "full") << "\t"
+            << installTime * 1e3 << "\t"
+            << installTime * 1e6 / nNodes << "\t"
+            << memoryGrowth << "\t"
+            << memoryGrowth * 1024 / nNodes << "\n";
+
+  Simulator::Destroy();
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::run(argc, argv);
+}
@@ -0,0 +1,131 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-tag-host-benchmark.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/utils/ndn-ns3-packet-tag.hpp"
+
+#include "benchmark-common.hpp"
+
+#include <ndn-cxx/lp/tags.hpp>
+
+#include <iostream>
+
+namespace ns3 {
+
+/**
+ * setTag and getTag throughput on Interest and Data packets
+ *
+ * Each packet gets the tags that the link service and the forwarder set on every packet
+ * (IncomingFaceIdTag, HopCountTag and CongestionMarkTag), which are stored in fixed slots,
+ * and then an Ns3PacketTag, which is stored in the map of other tags.  All tags are then read
+ * back.
+ *
+ *     ./waf --run ndn-tag-host-benchmark --command-template="%s --packets=1000000"
+ */
+
+template<typename T>
+static bool
+runPackets(const std::string& packetType, const std::vector<shared_ptr<T>>& packets)
+{
+  size_t nPackets = packets.size();
+  Ptr<const Packet> ns3Packet = Create<Packet>();
+  uint64_t sum = 0;
+  size_t nFound = 0;
+
+  double setSlotTime = measure(nPackets, [&] (size_t i) {
+    packets[i]->setTag(make_shared<::ndn::lp::IncomingFaceIdTag>(i));
+    packets[i]->setTag(make_shared<::ndn::lp::HopCountTag>(1));
+    packets[i]->setTag(make_shared<::ndn::lp::CongestionMarkTag>(0));
+  });
+  double getSlotTime = measure(nPackets, [&] (size_t i) {
+    sum += *packets[i]->template getTag<::ndn::lp::IncomingFaceIdTag>();
+    sum += *packets[i]->template getTag<::ndn::lp::HopCountTag>();
+    sum += *packets[i]->template getTag<::ndn::lp::CongestionMarkTag>();
+  });
+  double setMapTime = measure(nPackets, [&] (size_t i) {
+    packets[i]->setTag(make_shared<ndn::Ns3PacketTag>(ns3Packet));
+  });
+  double getMapTime = measure(nPackets, [&] (size_t i) {
+    nFound += packets[i]->template getTag<ndn::Ns3PacketTag>() != nullptr;
+  });
+
+  std::cout << packetType << "\t"
+            << "slot"
+            << "\t"
+            << setSlotTime * 1e9 / (nPackets * 3) << "\t"
+            << getSlotTime * 1e9 / (nPackets * 3) << "\n";
+  std::cout << packetType << "\t"
+            << "map"
+            << "\t"
+            << setMapTime * 1e9 / nPackets << "\t"
+            << getMapTime * 1e9 / nPackets << "\n";
+
+  return sum == nPackets * (nPackets - 1) / 2 + nPackets && nFound == nPackets;
+}
+
+static int
+run(int argc, char* argv[])
+{
+  size_t nPackets = 1000000;
+
+  CommandLine cmd;
+  cmd.AddValue("packets", "Number of packets of each type", nPackets);
+  cmd.Parse(argc, argv);
+
+  std::vector<shared_ptr<::ndn::Interest>> interests;
+  std::vector<shared_ptr<::ndn::Data>> data;
+  interests.reserve(nPackets);
+  data.reserve(nPackets);
+  for (size_t i = 0; i < nPackets; ++i) {
+    ::ndn::Name name = ::ndn::Name("/prefix").appendSequenceNumber(i);
+    interests.push_back(make_shared<::ndn::Interest>(name));
+    data.push_back(make_shared<::ndn::Data>(name));
+  }
+
+  std::cout << "Packet"
+            << "\t"
+            << "Storage"
+            << "\t"
+            << "setTag (ns/op)"
+            << "\t"
+            << "getTag (ns/op)"
+            << "\n";
+
+  bool isOk = runPackets("Interest", interests);
+  isOk = runPackets("Data", data) && isOk;
+
+  if (!isOk) {
+    std::cerr << "Unexpected tag values" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::run(argc, argv);
+}
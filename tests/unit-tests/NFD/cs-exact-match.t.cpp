@@ -0,0 +1,117 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/table/cs.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class CsExactMatchFixture : public CleanupFixture
+{
+public:
+  /** \return name of the found Data, or "/miss" if there is none
+   */
+  Name
+  find(const Interest& interest)
+  {
+    Name found("/miss");
+    cs.find(interest,
+            [&found] (const Interest&, const Data& data) { found = data.getFullName(); },
+            [] (const Interest&) {});
+    return found;
+  }
+
+  Name
+  find(const Name& name, bool canBePrefix)
+  {
+    Interest interest(name);
+    interest.setCanBePrefix(canBePrefix);
+    return find(interest);
+  }
+
+public:
+  nfd::Cs cs{3};
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestCsExactMatch, CsExactMatchFixture)
+
+BOOST_AUTO_TEST_CASE(Lookup)
+{
+  auto ab = makeData("/A/B");
+  auto abc = makeData("/A/B/C");
+  cs.insert(*ab);
+  cs.insert(*abc);
+
+  BOOST_CHECK_EQUAL(find("/A/B", false), ab->getFullName());
+  BOOST_CHECK_EQUAL(find("/A/B/C", false), abc->getFullName());
+  BOOST_CHECK_EQUAL(find("/A", false), Name("/miss"));
+  BOOST_CHECK_EQUAL(find("/A/B/C/D", false), Name("/miss"));
+  BOOST_CHECK_EQUAL(find("/A/C/B", false), Name("/miss"));
+
+  // prefix Interests still use the ordered table
+  BOOST_CHECK_EQUAL(find("/A", true), ab->getFullName());
+  BOOST_CHECK_EQUAL(find("/A/B/C", true), abc->getFullName());
+}
+
+BOOST_AUTO_TEST_CASE(SameName)
+{
+  auto first = makeData("/A/B", 1);
+  auto second = makeData("/A/B", 2);
+  cs.insert(*first);
+  cs.insert(*second);
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+
+  // the same Data as a scan of the prefix range would return
+  Name expected = std::min(first->getFullName(), second->getFullName());
+  BOOST_CHECK_EQUAL(find("/A/B", false), expected);
+  BOOST_CHECK_EQUAL(find("/A/B", true), expected);
+
+  BOOST_CHECK_EQUAL(find(first->getFullName(), false), first->getFullName());
+  BOOST_CHECK_EQUAL(find(second->getFullName(), false), second->getFullName());
+}
+
+BOOST_AUTO_TEST_CASE(EraseAndEvict)
+{
+  for (int i = 0; i < 5; ++i) {
+    cs.insert(*makeData(Name("/A").appendSequenceNumber(i)));
+  }
+  BOOST_CHECK_EQUAL(cs.size(), 3);
+
+  // evicted by the LRU policy
+  BOOST_CHECK_EQUAL(find(Name("/A").appendSequenceNumber(0), false), Name("/miss"));
+  BOOST_CHECK_EQUAL(find(Name("/A").appendSequenceNumber(1), false), Name("/miss"));
+  BOOST_CHECK_NE(find(Name("/A").appendSequenceNumber(4), false), Name("/miss"));
+
+  size_t nErased = 0;
+  cs.erase(Name("/A").appendSequenceNumber(4), 10, [&nErased] (size_t n) { nErased = n; });
+  BOOST_CHECK_EQUAL(nErased, 1);
+  BOOST_CHECK_EQUAL(find(Name("/A").appendSequenceNumber(4), false), Name("/miss"));
+  BOOST_CHECK_NE(find(Name("/A").appendSequenceNumber(3), false), Name("/miss"));
+
+  // re-inserted after erase
+  cs.insert(*makeData(Name("/A").appendSequenceNumber(4)));
+  BOOST_CHECK_NE(find(Name("/A").appendSequenceNumber(4), false), Name("/miss"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,115 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/table/cs.hpp"
+#include "helper/ndn-stack-helper.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class CsWireOnlyFixture : public CleanupFixture
+{
+public:
+  CsWireOnlyFixture()
+  {
+    cs.enableWireOnly(true);
+  }
+
+  /** \return wire encoding of the found Data, or an empty Block if there is none
+   */
+  Block
+  find(const Name& name, bool canBePrefix, bool mustBeFresh = false)
+  {
+    Interest interest(name);
+    interest.setCanBePrefix(canBePrefix);
+    interest.setMustBeFresh(mustBeFresh);
+
+    Block found;
+    cs.find(interest,
+            [&found] (const Interest&, const Data& data) { found = data.wireEncode(); },
+            [] (const Interest&) {});
+    return found;
+  }
+
+public:
+  nfd::Cs cs{10};
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestCsWireOnly, CsWireOnlyFixture)
+
+BOOST_AUTO_TEST_CASE(Lookup)
+{
+  auto first = makeData("/A/B", 1);
+  auto second = makeData("/A/B", 2);
+  auto abc = makeData("/A/B/C");
+  cs.insert(*first);
+  cs.insert(*second);
+  cs.insert(*abc);
+  BOOST_CHECK_EQUAL(cs.size(), 3);
+
+  for (const auto& entry : cs) {
+    BOOST_CHECK(entry.isWireOnly());
+  }
+
+  BOOST_CHECK(find("/A/B/C", false) == abc->wireEncode());
+  BOOST_CHECK(find("/A/B/C", true, true) == abc->wireEncode());
+  BOOST_CHECK(find(first->getFullName(), false) == first->wireEncode());
+  BOOST_CHECK(find(second->getFullName(), false) == second->wireEncode());
+  BOOST_CHECK(!find("/A/C", true).hasWire());
+
+  // the same order as with stored Data packets
+  const Data& lowest = first->getFullName() < second->getFullName() ? *first : *second;
+  BOOST_CHECK(find("/A", true) == lowest.wireEncode());
+  BOOST_CHECK(find("/A/B", false) == lowest.wireEncode());
+
+  BOOST_CHECK_EQUAL(cs.begin()->getFullName(), lowest.getFullName());
+  BOOST_CHECK_EQUAL(cs.begin()->getData()->getName(), "/A/B");
+}
+
+BOOST_AUTO_TEST_CASE(MustBeFresh)
+{
+  auto data = make_shared<Data>("/A");
+  StackHelper::getKeyChain().sign(*data);
+  cs.insert(*data);
+
+  BOOST_CHECK(find("/A", false).hasWire());
+  BOOST_CHECK(!find("/A", false, true).hasWire());
+}
+
+BOOST_AUTO_TEST_CASE(MemoryUsage)
+{
+  auto data = makeData("/A/B/C/D");
+  cs.insert(*data);
+  size_t wireOnlyUsage = cs.getMemoryUsage();
+  BOOST_CHECK_GT(wireOnlyUsage, data->wireEncode().size());
+
+  nfd::Cs dataCs(10);
+  dataCs.insert(*data);
+  BOOST_CHECK_LT(wireOnlyUsage, dataCs.getMemoryUsage());
+
+  cs.erase("/", 10, [] (size_t) {});
+  BOOST_CHECK_EQUAL(cs.getMemoryUsage(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,181 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/table/dead-nonce-list.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/name-tree-hashtable.hpp"
+
+#include "../tests-common.hpp"
+
+#include <deque>
+#include <random>
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(TestDeadNonceListFilter, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(PackedArrayModel)
+{
+  // widths that make elements straddle words
+  for (unsigned width : {1, 3, 11, 32, 37, 54, 63}) {
+    BOOST_TEST_CONTEXT("width " << width) {
+      nfd::PackedArray array(1000, width);
+      std::vector<uint64_t> model(array.size(), 0);
+      std::mt19937_64 rng(width);
+      uint64_t mask = (uint64_t(1) << width) - 1;
+
+      for (int i = 0; i < 5000; ++i) {
+        size_t index = rng() % array.size();
+        uint64_t value = rng() & mask;
+        array.set(index, value);
+        model[index] = value;
+      }
+      for (size_t i = 0; i < array.size(); ++i) {
+        BOOST_REQUIRE_EQUAL(array.get(i), model[i]);
+      }
+      BOOST_CHECK_EQUAL(array.getMemoryUsage(), (1000 * width + 63) / 64 * 8);
+    }
+  }
+
+  nfd::PackedQueue queue(37);
+  std::deque<uint64_t> model;
+  std::mt19937_64 rng(1);
+  for (int i = 0; i < 10000; ++i) {
+    if (rng() % 3 != 0 || model.empty()) {
+      uint64_t value = rng() & ((uint64_t(1) << 37) - 1);
+      queue.push_back(value);
+      model.push_back(value);
+    }
+    else {
+      BOOST_REQUIRE_EQUAL(queue.front(), model.front());
+      queue.pop_front();
+      model.pop_front();
+    }
+    BOOST_REQUIRE_EQUAL(queue.size(), model.size());
+  }
+  for (size_t i = 0; i < model.size(); ++i) {
+    BOOST_REQUIRE_EQUAL(queue[i], model[i]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(QuotientFilterModel)
+{
+  // small fingerprints, so that clusters wrap around and fingerprints repeat
+  nfd::QuotientFilter filter(5, 3);
+  std::multiset<uint64_t> model;
+  std::mt19937_64 rng(1);
+
+  for (int i = 0; i < 20000; ++i) {
+    uint64_t hash = rng() & 0xFF;
+    switch (rng() % 3) {
+      case 0:
+        if (filter.size() < filter.getNSlots()) {
+          filter.insert(hash);
+          model.insert(hash);
+        }
+        break;
+      case 1: {
+        auto it = model.find(hash);
+        BOOST_REQUIRE_EQUAL(filter.erase(hash), it != model.end());
+        if (it != model.end()) {
+          model.erase(it);
+        }
+        break;
+      }
+      default:
+        BOOST_REQUIRE_EQUAL(filter.contains(hash), model.count(hash) > 0);
+        break;
+    }
+    BOOST_REQUIRE_EQUAL(filter.size(), model.size());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(QuotientFilterFalsePositives)
+{
+  nfd::QuotientFilter filter(12, 8);
+  std::mt19937_64 rng(1);
+  for (size_t i = 0; i < filter.getNSlots() * 3 / 4; ++i) {
+    filter.insert(rng());
+  }
+
+  // expected rate is 0.75 * 2^-8 = 0.29%
+  size_t nFalsePositives = 0;
+  for (int i = 0; i < 100000; ++i) {
+    nFalsePositives += filter.contains(rng());
+  }
+  BOOST_CHECK_LT(nFalsePositives, 500);
+
+  // each slot takes remainderBits + 3 bits
+  BOOST_CHECK_EQUAL(filter.getMemoryUsage(), filter.getNSlots() * 11 / 8);
+}
+
+BOOST_AUTO_TEST_CASE(HasAdd)
+{
+  nfd::DeadNonceList dnl;
+  dnl.enableQuotientFilter(0.001);
+  BOOST_CHECK(dnl.isQuotientFilterEnabled());
+
+  Name a("/A");
+  dnl.add(a, 1);
+  BOOST_CHECK(dnl.has(a, 1));
+  BOOST_CHECK(dnl.has(nfd::name_tree::computeHash(a), 1));
+  BOOST_CHECK(!dnl.has(a, 2));
+  BOOST_CHECK(!dnl.has("/B", 1));
+
+  // the filter grows beyond its initial capacity
+  for (uint32_t nonce = 2; nonce < 1000; ++nonce) {
+    dnl.add(nfd::name_tree::computeHash(a), nonce);
+  }
+  size_t nMissing = 0;
+  for (uint32_t nonce = 1000 - dnl.size(); nonce < 1000; ++nonce) {
+    nMissing += !dnl.has(a, nonce);
+  }
+  BOOST_CHECK_EQUAL(nMissing, 0);
+
+  size_t nFalsePositives = 0;
+  for (uint32_t nonce = 0; nonce < 10000; ++nonce) {
+    nFalsePositives += dnl.has("/B", nonce);
+  }
+  BOOST_CHECK_LT(nFalsePositives, 50);
+
+  // entries are kept with shorter fingerprints
+  size_t size = dnl.size();
+  dnl.enableQuotientFilter(0.01);
+  BOOST_CHECK_EQUAL(dnl.size(), size);
+  BOOST_CHECK(dnl.has(a, 999));
+
+  // only fingerprints are stored, so entries are dropped when switching back to the hashtable
+  dnl.enableQuotientFilter(0.0);
+  BOOST_CHECK(!dnl.isQuotientFilterEnabled());
+  BOOST_CHECK_EQUAL(dnl.size(), 0);
+  BOOST_CHECK(!dnl.has(a, 999));
+
+  // entries are kept when switching from the hashtable
+  dnl.add(a, 1);
+  dnl.enableQuotientFilter(0.001);
+  BOOST_CHECK_EQUAL(dnl.size(), 1);
+  BOOST_CHECK(dnl.has(a, 1));
+
+  BOOST_CHECK_THROW(dnl.enableQuotientFilter(1.0), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,101 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/fw/downstream-collector.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/face-table.hpp"
+#include "ns3/ndnSIM/NFD/daemon/face/null-face.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class DownstreamCollectorFixture : public CleanupFixture
+{
+public:
+  DownstreamCollectorFixture()
+  {
+    // more faces than bits in the bitmap, so that some FaceIds share a bit
+    for (size_t i = 0; i < 70; ++i) {
+      auto face = nfd::face::makeNullFace();
+      faceTable.add(face);
+      faces.push_back(face.get());
+    }
+  }
+
+public:
+  nfd::FaceTable faceTable;
+  std::vector<nfd::Face*> faces;
+  nfd::fw::DownstreamCollector collector;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestDownstreamCollector, DownstreamCollectorFixture)
+
+BOOST_AUTO_TEST_CASE(InsertionOrder)
+{
+  BOOST_CHECK(collector.empty());
+  BOOST_CHECK(collector.add(*faces[3]));
+  BOOST_CHECK(collector.add(*faces[1]));
+  BOOST_CHECK(!collector.add(*faces[3]));
+  BOOST_CHECK(collector.add(*faces[2]));
+  BOOST_CHECK(!collector.add(*faces[1]));
+
+  std::vector<nfd::Face*> collected;
+  for (const auto& downstream : collector) {
+    collected.push_back(downstream.first);
+    BOOST_CHECK_EQUAL(downstream.second, 0);
+  }
+  std::vector<nfd::Face*> expected{faces[3], faces[1], faces[2]};
+  BOOST_CHECK_EQUAL_COLLECTIONS(collected.begin(), collected.end(),
+                                expected.begin(), expected.end());
+
+  collector.clear();
+  BOOST_CHECK(collector.empty());
+  BOOST_CHECK(collector.add(*faces[3]));
+}
+
+BOOST_AUTO_TEST_CASE(Endpoints)
+{
+  BOOST_CHECK(collector.add(*faces[0], 1));
+  BOOST_CHECK(collector.add(*faces[0], 2));
+  BOOST_CHECK(!collector.add(*faces[0], 1));
+  BOOST_CHECK_EQUAL(collector.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(Overflow)
+{
+  // every face twice, beyond the inline capacity and with FaceIds sharing bitmap bits
+  for (int round = 0; round < 2; ++round) {
+    for (nfd::Face* face : faces) {
+      BOOST_CHECK_EQUAL(collector.add(*face), round == 0);
+    }
+  }
+  BOOST_CHECK_GT(faces.size(), nfd::fw::DownstreamCollector::INLINE_CAPACITY);
+  BOOST_REQUIRE_EQUAL(collector.size(), faces.size());
+
+  size_t i = 0;
+  for (const auto& downstream : collector) {
+    BOOST_CHECK_EQUAL(downstream.first, faces[i++]);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,107 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_TESTS_UNIT_TESTS_NFD_DUMMY_FACE_HPP
+#define NDNSIM_TESTS_UNIT_TESTS_NFD_DUMMY_FACE_HPP
+
+#include "ns3/ndnSIM/NFD/daemon/face/face.hpp"
+#include "ns3/ndnSIM/NFD/daemon/face/link-service.hpp"
+#include "ns3/ndnSIM/NFD/daemon/face/null-transport.hpp"
+
+#include "model/ndn-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+/** \brief a link service that records sent packets and lets the test inject received ones
+ */
+class DummyLinkService : public nfd::face::LinkService
+{
+public:
+  void
+  receiveInterest(const Interest& interest, const nfd::EndpointId& endpoint = 0)
+  {
+    this->LinkService::receiveInterest(interest, endpoint);
+  }
+
+  void
+  receiveData(const Data& data, const nfd::EndpointId& endpoint = 0)
+  {
+    this->LinkService::receiveData(data, endpoint);
+  }
+
+private:
+  void
+  doSendInterest(const Interest& interest, const nfd::EndpointId&) override
+  {
+    sentInterests.push_back(interest);
+  }
+
+  void
+  doSendData(const Data& data, const nfd::EndpointId&) override
+  {
+    sentData.push_back(data);
+  }
+
+  void
+  doSendNack(const lp::Nack&, const nfd::EndpointId&) override
+  {
+  }
+
+  void
+  doReceivePacket(const Block&, const nfd::EndpointId&) override
+  {
+  }
+
+public:
+  std::vector<Interest> sentInterests;
+  std::vector<Data> sentData;
+};
+
+/** \brief a transport of the given link type that sends nothing
+ */
+class DummyTransport : public nfd::face::NullTransport
+{
+public:
+  explicit
+  DummyTransport(::ndn::nfd::LinkType linkType)
+  {
+    this->setLinkType(linkType);
+  }
+};
+
+/** \brief create a face with a DummyLinkService
+ */
+inline shared_ptr<nfd::Face>
+makeDummyFace(::ndn::nfd::LinkType linkType = ::ndn::nfd::LINK_TYPE_POINT_TO_POINT)
+{
+  return make_shared<nfd::Face>(make_unique<DummyLinkService>(),
+                                make_unique<DummyTransport>(linkType));
+}
+
+inline DummyLinkService&
+getDummyLinkService(const nfd::Face& face)
+{
+  return static_cast<DummyLinkService&>(*face.getLinkService());
+}
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_TESTS_UNIT_TESTS_NFD_DUMMY_FACE_HPP
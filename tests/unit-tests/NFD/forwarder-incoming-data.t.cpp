@@ -0,0 +1,80 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2019  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+
+#include "dummy-face.hpp"
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class ForwarderIncomingDataFixture : public CleanupFixture
+{
+public:
+  ForwarderIncomingDataFixture()
+    : forwarder(faceTable)
+  {
+    for (auto face : {&face1, &face2, &upstream}) {
+      auto dummyFace = makeDummyFace();
+      faceTable.add(dummyFace);
+      *face = dummyFace.get();
+    }
+    forwarder.getFib().addOrUpdateNextHop(*forwarder.getFib().insert("/A").first, *upstream, 0);
+  }
+
+public:
+  nfd::FaceTable faceTable;
+  nfd::Forwarder forwarder;
+  nfd::Face* face1;
+  nfd::Face* face2;
+  nfd::Face* upstream;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestForwarderIncomingData, ForwarderIncomingDataFixture)
+
+BOOST_AUTO_TEST_CASE(MultiMatchIngressEndpoint)
+{
+  // two PIT entries match the Data: /A from face1 and /A/B from face2
+  Interest interest1("/A");
+  interest1.setCanBePrefix(true);
+  interest1.setNonce(1);
+  getDummyLinkService(*face1).receiveInterest(interest1, 1);
+
+  Interest interest2("/A/B");
+  interest2.setNonce(2);
+  getDummyLinkService(*face2).receiveInterest(interest2, 1);
+
+  BOOST_REQUIRE_EQUAL(getDummyLinkService(*upstream).sentInterests.size(), 2);
+  BOOST_REQUIRE_EQUAL(forwarder.getPit().size(), 2);
+
+  // the Data comes back on the point-to-point face1, from an endpoint other than 0, as from a
+  // NetDeviceTransport; it must not be sent back out on face1
+  auto data = makeData("/A/B");
+  getDummyLinkService(*face1).receiveData(*data, 1);
+
+  BOOST_CHECK_EQUAL(getDummyLinkService(*face1).sentData.size(), 0);
+  BOOST_CHECK_EQUAL(getDummyLinkService(*face2).sentData.size(), 1);
+  BOOST_CHECK_EQUAL(getDummyLinkService(*upstream).sentData.size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
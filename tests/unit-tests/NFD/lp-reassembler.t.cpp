@@ -0,0 +1,109 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/face/lp-fragmenter.hpp"
+#include "ns3/ndnSIM/NFD/daemon/face/lp-reassembler.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class LpReassemblerFixture : public CleanupFixture
+{
+public:
+  LpReassemblerFixture()
+    : fragmenter({})
+    , reassembler({})
+  {
+    auto data = make_shared<Data>("/prefix/data");
+    data->setContent(std::vector<uint8_t>(1000, 0xBB));
+    StackHelper::getKeyChain().sign(*data);
+    wire = data->wireEncode();
+  }
+
+public:
+  nfd::face::LpFragmenter fragmenter;
+  nfd::face::LpReassembler reassembler;
+  Block wire;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestLpReassembler, LpReassemblerFixture)
+
+BOOST_AUTO_TEST_CASE(Sequences)
+{
+  lp::Packet packet(wire);
+  packet.add<lp::HopCountTagField>(3);
+
+  bool isOk = false;
+  std::vector<lp::Packet> frags;
+  std::tie(isOk, frags) = fragmenter.fragmentPacket(packet, 102, 1000);
+  BOOST_REQUIRE(isOk);
+  BOOST_REQUIRE_GT(frags.size(), 10);
+  for (size_t i = 0; i < frags.size(); ++i) {
+    BOOST_CHECK_LE(frags[i].wireEncode().size(), 102);
+    BOOST_CHECK_EQUAL(frags[i].get<lp::SequenceField>(), 1000 + i);
+    BOOST_CHECK_EQUAL(frags[i].get<lp::FragIndexField>(), i);
+    BOOST_CHECK_EQUAL(frags[i].has<lp::HopCountTagField>(), i == 0);
+  }
+
+  // a packet that fits in the MTU is left without sequence number
+  std::tie(isOk, frags) = fragmenter.fragmentPacket(packet, 1500, 1000);
+  BOOST_REQUIRE(isOk);
+  BOOST_REQUIRE_EQUAL(frags.size(), 1);
+  BOOST_CHECK(!frags.front().has<lp::SequenceField>());
+}
+
+BOOST_AUTO_TEST_CASE(OutOfOrder)
+{
+  lp::Packet packet(wire);
+  packet.add<lp::HopCountTagField>(3);
+
+  std::vector<lp::Packet> frags;
+  std::tie(std::ignore, frags) = fragmenter.fragmentPacket(packet, 102, 1000);
+  BOOST_REQUIRE_GT(frags.size(), 10);
+
+  // the last fragment is the shortest; the first one has the HopCount header
+  std::reverse(frags.begin(), frags.end());
+  std::swap(frags[1], frags.back());
+  frags.insert(frags.begin() + 3, frags[2]);
+
+  bool isReassembled = false;
+  Block netPkt;
+  lp::Packet firstPkt;
+  size_t nReassembled = 0;
+  for (const auto& frag : frags) {
+    std::tie(isReassembled, netPkt, firstPkt) =
+      reassembler.receiveFragment(0, lp::Packet(frag.wireEncode()));
+    if (isReassembled) {
+      ++nReassembled;
+      BOOST_CHECK_EQUAL_COLLECTIONS(netPkt.begin(), netPkt.end(), wire.begin(), wire.end());
+      // the reassembled packet does not keep the buffer of all strides alive
+      BOOST_CHECK_EQUAL(netPkt.getBuffer()->size(), wire.size());
+      BOOST_CHECK_EQUAL(firstPkt.get<lp::HopCountTagField>(), 3);
+    }
+  }
+  BOOST_CHECK_EQUAL(nReassembled, 1);
+  BOOST_CHECK_EQUAL(reassembler.size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
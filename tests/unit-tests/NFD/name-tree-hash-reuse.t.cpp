@@ -0,0 +1,109 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/table/cs.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/dead-nonce-list.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/pit.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class NameTreeHashReuseFixture : public CleanupFixture
+{
+public:
+  /** \return number of name hashings since the last call
+   */
+  uint64_t
+  countHashes()
+  {
+    uint64_t nNames = nfd::name_tree::getHashCounters().nNames;
+    uint64_t count = nNames - m_nNames;
+    m_nNames = nNames;
+    return count;
+  }
+
+public:
+  nfd::NameTree nameTree;
+  nfd::Pit pit{nameTree};
+  nfd::Cs cs{10};
+  nfd::DeadNonceList dnl;
+
+private:
+  uint64_t m_nNames = 0;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestNameTreeHashReuse, NameTreeHashReuseFixture)
+
+BOOST_AUTO_TEST_CASE(IncomingInterest)
+{
+  auto interest = make_shared<Interest>("/A/B/C");
+  interest->setNonce(1);
+  dnl.add("/A/B/C", 2);
+  countHashes();
+
+  // incoming Interest pipeline: Dead Nonce List, PIT insert, CS lookup
+  auto hashes = nfd::name_tree::computeHashes(interest->getName());
+  BOOST_CHECK(!dnl.has(hashes.back(), 1));
+  BOOST_CHECK(dnl.has(hashes.back(), 2));
+  auto pitEntry = pit.insert(*interest, hashes).first;
+  bool isMiss = false;
+  cs.find(*interest, hashes,
+          [] (const Interest&, const Data&) {},
+          [&isMiss] (const Interest&) { isMiss = true; });
+  BOOST_CHECK(isMiss);
+  BOOST_CHECK_EQUAL(countHashes(), 1);
+
+  // same result as the overloads that compute the hashes
+  BOOST_CHECK_EQUAL(pit.insert(*interest).first, pitEntry);
+  BOOST_CHECK_EQUAL(nameTree.getEntry(*pitEntry), &nameTree.lookup("/A/B/C"));
+  BOOST_CHECK_GE(countHashes(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(IncomingData)
+{
+  auto interest = make_shared<Interest>("/A/B");
+  interest->setCanBePrefix(true);
+  pit.insert(*interest);
+
+  auto data = makeData("/A/B/C");
+  countHashes();
+
+  // incoming Data pipeline: PIT match, CS insert
+  auto hashes = nfd::name_tree::computeHashes(data->getName());
+  auto matches = pit.findAllDataMatches(*data, hashes);
+  cs.insert(*data, hashes);
+  BOOST_CHECK_EQUAL(countHashes(), 1);
+  BOOST_REQUIRE_EQUAL(matches.size(), 1);
+  BOOST_CHECK_EQUAL(matches.front()->getName(), Name("/A/B"));
+
+  // the CS entry is found by an exact-match lookup that computes the hash
+  bool isHit = false;
+  cs.find(Interest("/A/B/C"),
+          [&isHit] (const Interest&, const Data&) { isHit = true; },
+          [] (const Interest&) {});
+  BOOST_CHECK(isHit);
+  BOOST_CHECK_EQUAL(countHashes(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
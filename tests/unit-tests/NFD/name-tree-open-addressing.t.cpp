@@ -0,0 +1,88 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/table/name-tree.hpp"
+
+#include "../tests-common.hpp"
+
+#include <boost/mpl/vector.hpp>
+
+namespace ns3 {
+namespace ndn {
+
+using nfd::name_tree::HashtableLayout;
+
+template<HashtableLayout LAYOUT>
+struct Layout : std::integral_constant<HashtableLayout, LAYOUT>
+{
+};
+
+using Layouts = boost::mpl::vector<Layout<HashtableLayout::CHAINED>,
+                                   Layout<HashtableLayout::OPEN_ADDRESSING>>;
+
+BOOST_FIXTURE_TEST_SUITE(TestNameTreeOpenAddressing, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(LookupErase, L, Layouts)
+{
+  nfd::NameTree nt(4, L::value);
+  BOOST_CHECK_EQUAL(nt.getLayout(), L::value);
+
+  nfd::name_tree::Entry& abc = nt.lookup("/A/B/C");
+  nfd::name_tree::Entry& abd = nt.lookup("/A/B/D");
+  // same hash as /A/B/C, because component hashes are combined with XOR
+  nfd::name_tree::Entry& cba = nt.lookup("/C/B/A");
+  BOOST_CHECK_EQUAL(nt.size(), 8);
+  BOOST_CHECK_EQUAL(abc.getName(), Name("/A/B/C"));
+  BOOST_CHECK_EQUAL(cba.getName(), Name("/C/B/A"));
+  BOOST_CHECK_EQUAL(&nt.lookup("/A/B/C"), &abc);
+  BOOST_CHECK_EQUAL(nt.findExactMatch("/C/B/A"), &cba);
+  BOOST_CHECK(nt.findExactMatch("/A/C") == nullptr);
+  BOOST_CHECK_EQUAL(nt.findLongestPrefixMatch("/A/B/D/E"), &abd);
+
+  // entries keep their address when the table grows
+  for (int i = 0; i < 1000; ++i) {
+    nt.lookup(Name("/E").appendNumber(i));
+  }
+  BOOST_CHECK_GT(nt.getNBuckets(), 1000);
+  BOOST_CHECK_EQUAL(nt.findExactMatch("/A/B/C"), &abc);
+  BOOST_CHECK_EQUAL(nt.findExactMatch("/C/B/A"), &cba);
+
+  size_t nEnumerated = 0;
+  for (const auto& entry : nt.fullEnumerate()) {
+    BOOST_CHECK_EQUAL(nt.findExactMatch(entry.getName()), &entry);
+    ++nEnumerated;
+  }
+  BOOST_CHECK_EQUAL(nEnumerated, nt.size());
+
+  // the table shrinks, and colliding entries are still found after an erase
+  for (int i = 0; i < 1000; ++i) {
+    nt.eraseIfEmpty(nt.findExactMatch(Name("/E").appendNumber(i)));
+  }
+  BOOST_CHECK_EQUAL(nt.size(), 8);
+  BOOST_CHECK_LT(nt.getNBuckets(), 1000);
+  BOOST_CHECK_EQUAL(nt.eraseIfEmpty(&abc, false), 1);
+  BOOST_CHECK(nt.findExactMatch("/A/B/C") == nullptr);
+  BOOST_CHECK_EQUAL(nt.findExactMatch("/C/B/A"), &cba);
+  BOOST_CHECK_EQUAL(nt.findExactMatch("/A/B/D"), &abd);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,242 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "helper/ndn-strategy-choice-helper.hpp"
+
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/pf-geo-strategy.hpp"
+
+#include <ndn-cxx/lp/geo-tag.hpp>
+#include <ndn-cxx/lp/tags.hpp>
+
+#include "dummy-face.hpp"
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class PfGeoFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  PfGeoFixture()
+  {
+    Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
+    Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("1ms"));
+    Config::SetDefault("ns3::QueueBase::MaxSize", StringValue("500p"));
+
+    //                 +----+     //
+    //              +- | B1 |     //
+    //             /   +----+     //
+    //  +----+    /               //
+    //  |    | --+                //
+    //  | A1 |                    //
+    //  |    | --+                //
+    //  +----+    \               //
+    //             \   +----+     //
+    //              +- | C1 |     //
+    //                 +----+     //
+
+    createTopology({
+        {"A1", "B1"},
+        {"A1", "C1"}
+      });
+
+    addRoutes({
+        {"A1", "B1", "/sensor", 200},
+        {"A1", "C1", "/sensor", 100},
+        {"A1", "B1", "/infra", 200},
+        {"A1", "C1", "/infra", 100}
+      });
+
+    addApps({
+        {"A1", "ns3::ndn::ConsumerCbr",
+            {{"Prefix", "/sensor"}, {"Frequency", "1"}},
+            "0.1s", "100s"},
+        {"A1", "ns3::ndn::ConsumerCbr",
+            {{"Prefix", "/infra"}, {"Frequency", "1"}},
+            "0.1s", "100s"},
+      });
+  }
+
+  fw::Strategy&
+  getEffectiveStrategy(const std::string& node, const Name& prefix)
+  {
+    return getNode(node)->GetObject<L3Protocol>()->getForwarder()
+      ->getStrategyChoice().findEffectiveStrategy(prefix);
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestPfGeoStrategy, PfGeoFixture)
+
+BOOST_AUTO_TEST_CASE(Parameters)
+{
+  StrategyChoiceHelper::Install(getNode("A1"), "/sensor",
+                                "/localhost/nfd/strategy/pf-geo/%FD%01/probability~0.5/retx~3");
+
+  auto strategy = dynamic_cast<nfd::fw::PfGeoStrategy*>(&getEffectiveStrategy("A1", "/sensor"));
+  BOOST_REQUIRE(strategy != nullptr);
+  BOOST_CHECK_EQUAL(strategy->getProbability(), 0.5);
+  BOOST_CHECK_EQUAL(strategy->getRetxThreshold(), 3);
+  BOOST_CHECK_EQUAL(strategy->getDiameterSlack(), 0);
+
+  BOOST_CHECK(dynamic_cast<nfd::fw::PfGeoStrategy*>(&getEffectiveStrategy("A1", "/infra")) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(PerPrefix)
+{
+  StrategyChoiceHelper::Install(getNode("A1"), "/sensor", "/localhost/nfd/strategy/pf-geo");
+  StrategyChoiceHelper::Install(getNode("A1"), "/infra", "/localhost/nfd/strategy/best-route");
+
+  Simulator::Stop(Seconds(5));
+  Simulator::Run();
+
+  // point-to-point faces are never re-broadcast: pf-geo floods /sensor to all nexthops,
+  // best-route sends /infra only to the cheapest one
+  BOOST_CHECK_EQUAL(getFace("A1", "B1")->getCounters().nOutInterests, 5);
+  BOOST_CHECK_EQUAL(getFace("A1", "C1")->getCounters().nOutInterests, 10);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+/** \brief a forwarder with a single ad hoc face, which is the broadcast face and the nexthop
+ *         of every prefix, so that every forwarded Interest is a re-broadcast
+ */
+class AdHocFixture : public CleanupFixture
+{
+public:
+  AdHocFixture()
+    : forwarder(faceTable)
+  {
+    auto face = makeDummyFace(::ndn::nfd::LINK_TYPE_AD_HOC);
+    faceTable.add(face);
+    adHocFace = face.get();
+    adHocLinkService = &getDummyLinkService(*adHocFace);
+
+    forwarder.setBroadcastFaceId(adHocFace->getId());
+    forwarder.getFib().addOrUpdateNextHop(*forwarder.getFib().insert("/").first, *adHocFace, 0);
+  }
+
+  /** \brief receive an Interest on the ad hoc face
+   *  \return whether it was re-broadcast
+   */
+  bool
+  receive(const Name& name, uint32_t diameter, uint32_t retx, uint64_t hopCount)
+  {
+    Interest interest(name);
+    interest.setNonce(++m_nonce);
+    if (diameter > 0 || retx > 0) {
+      interest.setTag(make_shared<lp::GeoTag>(std::make_tuple(diameter, retx, diameter)));
+    }
+    interest.setTag(make_shared<lp::HopCountTag>(hopCount));
+
+    size_t nSent = adHocLinkService->sentInterests.size();
+    adHocLinkService->receiveInterest(interest);
+    return adHocLinkService->sentInterests.size() > nSent;
+  }
+
+  /** \brief receive Interests with distinct names on the ad hoc face
+   *  \return number of them that were re-broadcast
+   */
+  size_t
+  receiveMany(const Name& prefix, size_t nInterests, uint32_t retx = 0)
+  {
+    size_t nRebroadcast = 0;
+    for (size_t i = 0; i < nInterests; ++i) {
+      nRebroadcast += receive(Name(prefix).appendSequenceNumber(i), 0, retx, 1);
+    }
+    return nRebroadcast;
+  }
+
+public:
+  nfd::FaceTable faceTable;
+  nfd::Forwarder forwarder;
+  nfd::Face* adHocFace;
+  DummyLinkService* adHocLinkService;
+
+private:
+  uint32_t m_nonce = 0;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestPfGeoStrategyAdHoc, AdHocFixture)
+
+BOOST_AUTO_TEST_CASE(DiameterRule)
+{
+  forwarder.getStrategyChoice().insert("/sensor",
+                                       "/localhost/nfd/strategy/pf-geo/%FD%01/probability~1");
+  forwarder.getStrategyChoice().insert("/slack",
+    "/localhost/nfd/strategy/pf-geo/%FD%01/probability~1/diameter-slack~1");
+
+  BOOST_CHECK(receive("/sensor/1", 3, 0, 3));
+  BOOST_CHECK(!receive("/sensor/2", 3, 0, 4));
+  BOOST_CHECK(receive("/sensor/3", 0, 0, 100)); // unknown diameter
+
+  BOOST_CHECK(receive("/slack/1", 3, 0, 4));
+  BOOST_CHECK(!receive("/slack/2", 3, 0, 5));
+}
+
+BOOST_AUTO_TEST_CASE(RetxRule)
+{
+  forwarder.getStrategyChoice().insert("/sensor",
+    "/localhost/nfd/strategy/pf-geo/%FD%01/probability~0/retx~2");
+
+  // the forwarder's own RebroadcastProbability does not drop the flood decision
+  forwarder.setRebroadcastProbability(0.0);
+  BOOST_CHECK_EQUAL(receiveMany("/sensor/retx2", 100, 2), 100);
+  BOOST_CHECK_EQUAL(receiveMany("/sensor/retx3", 100, 3), 100);
+  BOOST_CHECK_EQUAL(receiveMany("/sensor/retx1", 100, 1), 0);
+
+  // a retransmission is flooded again at once, bypassing retx suppression
+  BOOST_CHECK(receive("/sensor/again", 0, 2, 1));
+  BOOST_CHECK(receive("/sensor/again", 0, 2, 1));
+  BOOST_CHECK_EQUAL(adHocFace->getCounters().nOutInterests, 202);
+}
+
+BOOST_AUTO_TEST_CASE(ProbabilityRule)
+{
+  forwarder.getStrategyChoice().insert("/sensor",
+                                       "/localhost/nfd/strategy/pf-geo/%FD%01/probability~0.5");
+
+  // pf-geo streams come after the forwarder's own stream
+  BOOST_CHECK_EQUAL(forwarder.assignStreams(100), 2);
+  forwarder.setRebroadcastProbability(0.0);
+  size_t nRebroadcast = receiveMany("/sensor/first", 1000);
+  BOOST_CHECK_GT(nRebroadcast, 400);
+  BOOST_CHECK_LT(nRebroadcast, 600);
+
+  // the same stream gives the same decisions
+  forwarder.assignStreams(100);
+  BOOST_CHECK_EQUAL(receiveMany("/sensor/second", 1000), nRebroadcast);
+}
+
+BOOST_AUTO_TEST_CASE(OtherStrategies)
+{
+  // strategies that do not decide themselves are subject to RebroadcastProbability
+  forwarder.getStrategyChoice().insert("/infra", "/localhost/nfd/strategy/best-route");
+
+  forwarder.setRebroadcastProbability(0.0);
+  BOOST_CHECK_EQUAL(receiveMany("/infra/first", 100), 0);
+
+  forwarder.setRebroadcastProbability(1.0);
+  BOOST_CHECK_EQUAL(receiveMany("/infra/second", 100), 100);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,127 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/table/pit-entry.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/face-table.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/strategy-info.hpp"
+#include "ns3/ndnSIM/NFD/daemon/face/null-face.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class PitEntryRecordsFixture : public CleanupFixture
+{
+public:
+  PitEntryRecordsFixture()
+    : interest(make_shared<Interest>("/prefix"))
+    , entry(*interest)
+  {
+    // more faces than records stored inside the entry
+    for (size_t i = 0; i < 2 * nfd::pit::FACE_RECORDS_INLINE_CAPACITY + 2; ++i) {
+      auto face = nfd::face::makeNullFace();
+      faceTable.add(face);
+      faces.push_back(face.get());
+    }
+  }
+
+public:
+  nfd::FaceTable faceTable;
+  std::vector<nfd::Face*> faces;
+  shared_ptr<Interest> interest;
+  nfd::pit::Entry entry;
+};
+
+class TestRecordInfo : public nfd::fw::StrategyInfo
+{
+public:
+  static constexpr int
+  getTypeId()
+  {
+    return 9001;
+  }
+
+  explicit
+  TestRecordInfo(size_t value)
+    : value(value)
+  {
+  }
+
+public:
+  size_t value;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestPitEntryRecords, PitEntryRecordsFixture)
+
+BOOST_AUTO_TEST_CASE(InRecords)
+{
+  for (size_t i = 0; i < faces.size(); ++i) {
+    auto inRecord = entry.insertOrUpdateInRecord(*faces[i], *interest);
+    BOOST_CHECK_EQUAL(&inRecord->getFace(), faces[i]);
+    inRecord->insertStrategyInfo<TestRecordInfo>(i);
+  }
+  BOOST_CHECK(entry.insertOrUpdateInRecord(*faces[1], *interest) != entry.in_end());
+  BOOST_CHECK_EQUAL(entry.getInRecords().size(), faces.size());
+
+  // the last inserted in-record comes first
+  size_t i = faces.size();
+  for (const nfd::pit::InRecord& inRecord : entry.getInRecords()) {
+    --i;
+    BOOST_CHECK_EQUAL(&inRecord.getFace(), faces[i]);
+  }
+
+  entry.deleteInRecord(*faces[0]);
+  entry.deleteInRecord(*faces[2]);
+  BOOST_CHECK(entry.getInRecord(*faces[0]) == entry.in_end());
+  BOOST_CHECK(entry.getInRecord(*faces[2]) == entry.in_end());
+  for (i = 1; i < faces.size(); i += 2) {
+    auto inRecord = entry.getInRecord(*faces[i]);
+    BOOST_REQUIRE(inRecord != entry.in_end());
+    BOOST_REQUIRE(inRecord->getStrategyInfo<TestRecordInfo>() != nullptr);
+    BOOST_CHECK_EQUAL(inRecord->getStrategyInfo<TestRecordInfo>()->value, i);
+  }
+
+  entry.clearInRecords();
+  BOOST_CHECK(!entry.hasInRecords());
+}
+
+BOOST_AUTO_TEST_CASE(OutRecords)
+{
+  for (size_t i = 0; i < faces.size(); ++i) {
+    entry.insertOrUpdateOutRecord(*faces[i], *interest);
+  }
+  lp::Nack nack(*interest);
+  BOOST_CHECK(entry.getOutRecord(*faces[1])->setIncomingNack(nack));
+
+  entry.deleteOutRecord(*faces[0]);
+  BOOST_CHECK_EQUAL(entry.getOutRecords().size(), faces.size() - 1);
+  BOOST_CHECK(entry.getOutRecord(*faces[1])->getIncomingNack() != nullptr);
+  BOOST_CHECK(entry.getOutRecord(*faces[2])->getIncomingNack() == nullptr);
+
+  for (size_t i = 1; i < faces.size(); ++i) {
+    entry.deleteOutRecord(*faces[i]);
+  }
+  BOOST_CHECK(!entry.hasOutRecords());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
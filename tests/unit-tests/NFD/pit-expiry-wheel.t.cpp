@@ -0,0 +1,125 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/table/pit-entry.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class PitExpiryWheelFixture : public CleanupFixture
+{
+public:
+  PitExpiryWheelFixture()
+    : wheel([this] (const shared_ptr<nfd::pit::Entry>& entry) {
+        firedAt[entry.get()].push_back(Simulator::Now());
+      })
+  {
+  }
+
+  shared_ptr<nfd::pit::Entry>
+  makeEntry(const Name& name)
+  {
+    return make_shared<nfd::pit::Entry>(*make_shared<Interest>(name));
+  }
+
+  void
+  runUntil(Time time)
+  {
+    Simulator::Stop(time - Simulator::Now());
+    Simulator::Run();
+  }
+
+public:
+  nfd::pit::ExpiryWheel wheel;
+  std::map<const nfd::pit::Entry*, std::vector<Time>> firedAt;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestPitExpiryWheel, PitExpiryWheelFixture)
+
+BOOST_AUTO_TEST_CASE(Fire)
+{
+  std::vector<std::pair<shared_ptr<nfd::pit::Entry>, time::milliseconds>> timers;
+  // level 0, upper levels, and zero duration
+  for (auto duration : {1_ms, 10_ms, 255_ms, 256_ms, 4000_ms, 20000000_ms, 0_ms}) {
+    timers.emplace_back(makeEntry(Name("/A").appendNumber(timers.size())), duration);
+  }
+
+  Simulator::Schedule(MicroSeconds(1500), [&] {
+    for (const auto& timer : timers) {
+      wheel.schedule(timer.first->expiryTimer, timer.first, timer.second);
+      BOOST_CHECK(static_cast<bool>(timer.first->expiryTimer));
+    }
+  });
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+
+  runUntil(Seconds(20001));
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+
+  for (const auto& timer : timers) {
+    BOOST_CHECK(!timer.first->expiryTimer);
+    BOOST_REQUIRE_EQUAL(firedAt[timer.first.get()].size(), 1);
+
+    // fired at the next millisecond boundary
+    Time expiry = MicroSeconds(1500) + MilliSeconds(timer.second.count());
+    Time fired = firedAt[timer.first.get()].front();
+    if (timer.second == 0_ms) {
+      BOOST_CHECK_EQUAL(fired, expiry);
+    }
+    else {
+      BOOST_CHECK_EQUAL(fired, expiry + MicroSeconds(500));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(CancelAndReschedule)
+{
+  auto a = makeEntry("/A");
+  auto b = makeEntry("/B");
+  auto c = makeEntry("/C");
+  wheel.schedule(a->expiryTimer, a, 100_ms);
+  wheel.schedule(b->expiryTimer, b, 100_ms);
+  wheel.schedule(c->expiryTimer, c, 100_ms);
+  BOOST_CHECK_EQUAL(wheel.size(), 3);
+
+  a->expiryTimer.cancel();
+  BOOST_CHECK(!a->expiryTimer);
+  wheel.schedule(b->expiryTimer, b, 300_ms);
+  BOOST_CHECK_EQUAL(wheel.size(), 2);
+
+  // a destructed PIT entry does not fire
+  nfd::pit::Entry* cPtr = c.get();
+  c.reset();
+  BOOST_CHECK_EQUAL(wheel.size(), 1);
+
+  runUntil(MilliSeconds(200));
+  BOOST_CHECK_EQUAL(firedAt.size(), 0);
+
+  runUntil(MilliSeconds(400));
+  BOOST_CHECK_EQUAL(firedAt.count(a.get()), 0);
+  BOOST_CHECK_EQUAL(firedAt.count(cPtr), 0);
+  BOOST_REQUIRE_EQUAL(firedAt[b.get()].size(), 1);
+  BOOST_CHECK_EQUAL(firedAt[b.get()].front(), MilliSeconds(300));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
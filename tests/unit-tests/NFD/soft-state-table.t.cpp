@@ -0,0 +1,128 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/table/bf-table.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/dmif-table.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/soft-state-table.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class SoftStateTableFixture : public CleanupFixture
+{
+public:
+  nfd::BfTable bfTable;
+  nfd::DmifTable dmifTable;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestSoftStateTable, SoftStateTableFixture)
+
+BOOST_AUTO_TEST_CASE(Bf)
+{
+  Name name("/A/B");
+
+  bfTable.insert2(name, 257, 258, 1);
+  bfTable.insert2(name, 257, 258, 1);
+  bfTable.insert2(name, 257, 259, 1);
+  bfTable.insert1("/A/C", 260, 2);
+  BOOST_CHECK_EQUAL(bfTable.size(), 3);
+
+  BOOST_CHECK_EQUAL(bfTable.getCounter2(name, 257, 258, 1), 2);
+  BOOST_CHECK_EQUAL(bfTable.getCounter2(name, 257, 259, 1), 1);
+  BOOST_CHECK_EQUAL(bfTable.getCounter2(name, 257, 258, 2), 0);
+  BOOST_CHECK_EQUAL(bfTable.getCounter1(name, 0, 1), 1);
+  BOOST_CHECK_EQUAL(bfTable.getInput1("/A/C", 2), 260);
+  BOOST_CHECK_EQUAL(bfTable.getInput1("/A/C", 1), 10000);
+  BOOST_CHECK_EQUAL(bfTable.getOutput2(name, 257, 259, 1), 259);
+
+  bfTable.erase1(name, 257, 1);
+  BOOST_CHECK_EQUAL(bfTable.getCounter2(name, 257, 259, 1), 0);
+  BOOST_CHECK_EQUAL(bfTable.getCounter2(name, 257, 258, 1), 2);
+
+  bfTable.erase2(name, 257, 258, 1);
+  BOOST_CHECK_EQUAL(bfTable.getCounter2(name, 257, 258, 1), 0);
+  BOOST_CHECK_EQUAL(bfTable.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(DmifExpiry)
+{
+  for (uint32_t i = 0; i < 1000; ++i) {
+    Name name = Name("/A").appendNumber(i);
+    BOOST_CHECK_EQUAL(dmifTable.findOrInsert(name, i, true, true, 1), i);
+  }
+  BOOST_CHECK_EQUAL(dmifTable.size(), 1000);
+
+  Name name = Name("/A").appendNumber(500);
+  BOOST_CHECK_EQUAL(dmifTable.findOrInsert(name, 500, false, true, 1), 500);
+  BOOST_CHECK_EQUAL(dmifTable.findOrInsert(name, 1, false, true, 1), 40000);
+  BOOST_CHECK_EQUAL(dmifTable.findOrInsert(name, 1, false, false, 1), 500);
+  BOOST_CHECK_EQUAL(dmifTable.findOrInsert(name, 500, false, true, 2), 40000);
+
+  Simulator::Schedule(MilliSeconds(nfd::DmifTable::DMIF_DELAY / 2), [this] {
+    dmifTable.findOrInsert("/B", 7, true, true, 2);
+  });
+
+  Simulator::Stop(MilliSeconds(nfd::DmifTable::DMIF_DELAY) + MilliSeconds(1));
+  Simulator::Run();
+  BOOST_CHECK_EQUAL(dmifTable.size(), 1);
+  BOOST_CHECK_EQUAL(dmifTable.findOrInsert("/B", 7, false, true, 2), 7);
+  BOOST_CHECK_EQUAL(dmifTable.findOrInsert(name, 500, false, true, 1), 40000);
+}
+
+BOOST_AUTO_TEST_CASE(RehashWrappedRun)
+{
+  // a name whose home slot is the last one of the initial 64 slots, so that its records wrap
+  // past the end of the array
+  Name name;
+  nfd::name_tree::HashValue h = 0;
+  for (uint64_t i = 0; (h & 63) != 63; ++i) {
+    name = Name("/wrap").appendNumber(i);
+    h = nfd::name_tree::computeHash(name);
+  }
+
+  nfd::SoftStateTable<int> table;
+  auto isAny = [] (int) { return true; };
+  for (int value = 1; value <= 3; ++value) {
+    table.insert(name, h, Seconds(0), value, false);
+  }
+  BOOST_CHECK_EQUAL(table.find(name, h, isAny)->value, 3);
+
+  // grow the table
+  for (int i = 0; i < 64; ++i) {
+    Name other = Name("/other").appendNumber(i);
+    table.insert(other, nfd::name_tree::computeHash(other), Seconds(0), i, false);
+  }
+  BOOST_CHECK_EQUAL(table.size(), 67);
+
+  // the most recently inserted record is still found first
+  BOOST_CHECK_EQUAL(table.find(name, h, isAny)->value, 3);
+  table.erase(*table.find(name, h, isAny));
+  BOOST_CHECK_EQUAL(table.find(name, h, isAny)->value, 2);
+  table.erase(*table.find(name, h, isAny));
+  BOOST_CHECK_EQUAL(table.find(name, h, isAny)->value, 1);
+  table.erase(*table.find(name, h, isAny));
+  BOOST_CHECK(table.find(name, h, isAny) == nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
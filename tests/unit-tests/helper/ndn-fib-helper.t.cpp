@@ -18,6 +18,7 @@
  **/
 
 #include "helper/ndn-fib-helper.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
 
 #include "../tests-common.hpp"
 
@@ -99,6 +100,52 @@ BOOST_AUTO_TEST_CASE(Helper4)
 
 BOOST_AUTO_TEST_SUITE_END() // AddRoute
 
+BOOST_FIXTURE_TEST_CASE(AddRoutes, ScenarioHelperWithCleanupFixture)
+{
+  createTopology({
+      {"1", "2"},
+      {"1", "3"}
+    });
+
+  nfd::Fib& fib = getNode("1")->GetObject<L3Protocol>()->getForwarder()->getFib();
+  std::vector<std::pair<Name, nfd::FaceId>> newNextHops;
+  nfd::signal::ScopedConnection connection = fib.afterNewNextHop.connect([&] (const Name& prefix, const nfd::fib::NextHop& nextHop) {
+      newNextHops.emplace_back(prefix, nextHop.getFace().getId());
+    });
+
+  auto face2 = getFace("1", "2");
+  auto face3 = getFace("1", "3");
+  FibHelper::AddRoutes(getNode("1"), {
+      {"/A", face2, 10},
+      {"/B", face2, 1},
+      {"/A", face3, 5},
+      {"/A", face2, 20}
+    });
+
+  const nfd::fib::Entry* entryA = fib.findExactMatch("/A");
+  BOOST_REQUIRE(entryA != nullptr);
+  BOOST_REQUIRE_EQUAL(entryA->getNextHops().size(), 2);
+  BOOST_CHECK_EQUAL(entryA->getNextHops()[0].getFace().getId(), face3->getId());
+  BOOST_CHECK_EQUAL(entryA->getNextHops()[0].getCost(), 5);
+  BOOST_CHECK_EQUAL(entryA->getNextHops()[1].getFace().getId(), face2->getId());
+  BOOST_CHECK_EQUAL(entryA->getNextHops()[1].getCost(), 20);
+
+  const nfd::fib::Entry* entryB = fib.findExactMatch("/B");
+  BOOST_REQUIRE(entryB != nullptr);
+  BOOST_CHECK_EQUAL(entryB->getNextHops().size(), 1);
+
+  // one notification per entry, for its best new nexthop
+  BOOST_REQUIRE_EQUAL(newNextHops.size(), 2);
+  BOOST_CHECK_EQUAL(newNextHops[0].first, Name("/A"));
+  BOOST_CHECK_EQUAL(newNextHops[0].second, face3->getId());
+  BOOST_CHECK_EQUAL(newNextHops[1].first, Name("/B"));
+
+  // updating costs does not add nexthops
+  FibHelper::AddRoutes(getNode("1"), {{"/A", face2, 1}});
+  BOOST_CHECK_EQUAL(newNextHops.size(), 2);
+  BOOST_CHECK_EQUAL(entryA->getNextHops()[0].getFace().getId(), face2->getId());
+}
+
 BOOST_AUTO_TEST_SUITE_END() // HelperNdnFibHelper
 
 } // namespace ndn
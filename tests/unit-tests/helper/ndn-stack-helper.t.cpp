@@ -18,6 +18,7 @@
  **/
 
 #include "helper/ndn-stack-helper.hpp"
+#include "helper/ndn-app-helper.hpp"
 #include "../tests-common.hpp"
 
 #include "ns3/point-to-point-module.h"
@@ -62,6 +63,111 @@ BOOST_AUTO_TEST_CASE(TestNfdContentStorePolicy)
   BOOST_CHECK_EQUAL(protoNode1->getForwarder()->getCs().getPolicy()->getName(), "priority_fifo");
 }
 
+BOOST_AUTO_TEST_CASE(MinimalProfile)
+{
+  NodeContainer nodes;
+  nodes.Create(2);
+
+  PointToPointHelper p2p;
+  p2p.Install(nodes.Get(0), nodes.Get(1));
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.setCsSize(10);
+  ndnHelper.setMinimalProfile(true);
+  ndnHelper.Install(nodes.Get(0));
+  ndnHelper.setMinimalProfile(false);
+  ndnHelper.Install(nodes.Get(1));
+
+  Ptr<L3Protocol> minimal = L3Protocol::getL3Protocol(nodes.Get(0));
+  BOOST_CHECK(!minimal->isManagementEnabled());
+  BOOST_CHECK(minimal->getFibManager() == nullptr);
+  BOOST_CHECK(L3Protocol::getL3Protocol(nodes.Get(1))->isManagementEnabled());
+
+  auto forwarder = minimal->getForwarder();
+  BOOST_CHECK_EQUAL(forwarder->getCs().getLimit(), 10);
+  BOOST_CHECK_EQUAL(forwarder->getCs().getPolicy()->getName(), "lru");
+  BOOST_CHECK(Name("/localhost/nfd/strategy/multicast")
+                .isPrefixOf(forwarder->getStrategyChoice().get("/localhost").second));
+  BOOST_CHECK(forwarder->getFib().findExactMatch("/localhost/nfd") == nullptr);
+
+  // helpers update the tables directly, without management commands
+  auto face = minimal->getFaceByNetDevice(nodes.Get(0)->GetDevice(0));
+  FibHelper::AddRoute(nodes.Get(0), "/prefix", face, 5);
+  const nfd::fib::Entry* entry = forwarder->getFib().findExactMatch("/prefix");
+  BOOST_REQUIRE(entry != nullptr);
+  BOOST_REQUIRE_EQUAL(entry->getNextHops().size(), 1);
+  BOOST_CHECK_EQUAL(entry->getNextHops().front().getCost(), 5);
+
+  FibHelper::RemoveRoute(nodes.Get(0), "/prefix", face);
+  BOOST_CHECK(forwarder->getFib().findExactMatch("/prefix") == nullptr);
+
+  StrategyChoiceHelper::Install(nodes.Get(0), "/prefix", "/localhost/nfd/strategy/multicast");
+  BOOST_CHECK(Name("/localhost/nfd/strategy/multicast")
+                .isPrefixOf(forwarder->getStrategyChoice().get("/prefix").second));
+}
+
+struct LpUsage
+{
+  uint64_t nInData;
+  uint64_t nOutFrames;
+  uint64_t nOutBytes;
+};
+
+/** \brief fetch Data of 200 octets over a link with an LR-WPAN-like MTU
+ *  \return Data received by the consumer, and NDNLPv2 frames and bytes sent by the producer
+ */
+static LpUsage
+runSmallMtu(bool isCompactLp)
+{
+  NodeContainer nodes;
+  nodes.Create(2);
+
+  PointToPointHelper p2p;
+  p2p.SetDeviceAttribute("Mtu", UintegerValue(114));
+  p2p.Install(nodes.Get(0), nodes.Get(1));
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.SetDefaultRoutes(true);
+  ndnHelper.setCompactLp(isCompactLp, {"/prefix/with/a/long/name"});
+  ndnHelper.Install(nodes);
+
+  AppHelper consumerHelper("ns3::ndn::ConsumerCbr");
+  consumerHelper.SetPrefix("/prefix/with/a/long/name");
+  consumerHelper.SetAttribute("Frequency", StringValue("10"));
+  consumerHelper.Install(nodes.Get(0)).Stop(Seconds(1));
+
+  AppHelper producerHelper("ns3::ndn::Producer");
+  producerHelper.SetPrefix("/prefix/with/a/long/name");
+  producerHelper.SetAttribute("PayloadSize", StringValue("200"));
+  producerHelper.Install(nodes.Get(1));
+
+  Simulator::Stop(Seconds(2));
+  Simulator::Run();
+
+  auto consumerFace = L3Protocol::getL3Protocol(nodes.Get(0))
+                        ->getFaceByNetDevice(nodes.Get(0)->GetDevice(0));
+  auto producerFace = L3Protocol::getL3Protocol(nodes.Get(1))
+                        ->getFaceByNetDevice(nodes.Get(1)->GetDevice(0));
+  LpUsage usage{consumerFace->getCounters().nInData, producerFace->getCounters().nOutPackets,
+                producerFace->getCounters().nOutBytes};
+
+  Simulator::Destroy();
+  return usage;
+}
+
+BOOST_AUTO_TEST_CASE(CompactLp)
+{
+  LpUsage full = runSmallMtu(false);
+  LpUsage compact = runSmallMtu(true);
+
+  BOOST_CHECK_GT(full.nInData, 0);
+  BOOST_CHECK_EQUAL(compact.nInData, full.nInData);
+  BOOST_CHECK_LT(compact.nOutFrames, full.nOutFrames);
+  BOOST_CHECK_LT(compact.nOutBytes, full.nOutBytes);
+  BOOST_TEST_MESSAGE("frames " << full.nOutFrames << " -> " << compact.nOutFrames
+                     << ", bytes " << full.nOutBytes << " -> " << compact.nOutBytes);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
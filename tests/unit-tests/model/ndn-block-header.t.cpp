@@ -160,6 +160,103 @@ BOOST_AUTO_TEST_CASE(PrintLpPacket)
   }
 }
 
+BOOST_AUTO_TEST_CASE(Deserialize)
+{
+  for (size_t payloadSize : {0, 10, 252, 253, 1024, 8000, 70000}) {
+    BOOST_TEST_CONTEXT("payload size " << payloadSize) {
+      auto payload = std::make_shared< ::ndn::Buffer>(payloadSize);
+      for (size_t i = 0; i < payloadSize; ++i) {
+        (*payload)[i] = static_cast<uint8_t>(i);
+      }
+      Block block(lp::tlv::LpPacket, payload);
+      block.encode();
+
+      Ptr<Packet> packet = Create<Packet>();
+      packet->AddHeader(BlockHeader(block));
+
+      BlockHeader header;
+      BOOST_CHECK_EQUAL(packet->PeekHeader(header), block.size());
+      BOOST_CHECK_EQUAL(header.getBlock().type(), lp::tlv::LpPacket);
+      BOOST_CHECK_EQUAL_COLLECTIONS(header.getBlock().begin(), header.getBlock().end(),
+                                    block.begin(), block.end());
+      BOOST_CHECK_EQUAL(packet->GetSize(), block.size()); // PeekHeader leaves packet intact
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(DeserializeTruncated)
+{
+  Block block = "6405 0102030405"_block;
+
+  Ptr<Packet> packet = Create<Packet>(block.wire(), block.size() - 1);
+  BlockHeader header;
+  BOOST_CHECK_THROW(packet->PeekHeader(header), ::ndn::tlv::Error);
+
+  packet = Create<Packet>(block.wire(), 1);
+  BOOST_CHECK_THROW(packet->PeekHeader(header), ::ndn::tlv::Error);
+}
+
+BOOST_AUTO_TEST_CASE(SharedWire)
+{
+  Block block = "6405 0102030405"_block;
+
+  Ptr<Packet> packet = Create<Packet>();
+  packet->AddHeader(BlockHeader(block));
+  BlockHeader::shareWire(packet, block);
+
+  // copies delivered to receivers keep the UID and share the wire of the sender
+  Ptr<Packet> copy = packet->Copy();
+  Block extracted = BlockHeader::extractBlock(copy);
+  BOOST_CHECK(extracted == block);
+  BOOST_CHECK(extracted.wire() == block.wire());
+
+  // a different packet is deserialized
+  Ptr<Packet> other = Create<Packet>();
+  other->AddHeader(BlockHeader(block));
+  extracted = BlockHeader::extractBlock(other);
+  BOOST_CHECK(extracted == block);
+  BOOST_CHECK(extracted.wire() != block.wire());
+
+  // a packet with the same UID but different content is deserialized
+  Block otherBlock = "6403 010203"_block;
+  Ptr<Packet> modified = Create<Packet>();
+  modified->AddHeader(BlockHeader(otherBlock));
+  BlockHeader::shareWire(modified, block);
+  extracted = BlockHeader::extractBlock(modified);
+  BOOST_CHECK(extracted == otherBlock);
+
+  // a truncated copy keeps the UID, but is deserialized
+  Ptr<Packet> truncated = packet->Copy();
+  truncated->RemoveAtEnd(1);
+  BOOST_CHECK_THROW(BlockHeader::extractBlock(truncated), ::ndn::tlv::Error);
+
+  // a copy whose TLV-VALUE was corrupted in flight keeps the UID, but is deserialized once
+  // the corruption is reported
+  Ptr<Packet> corrupted = packet->Copy();
+  std::vector<uint8_t> bytes(corrupted->GetSize());
+  corrupted->CopyData(bytes.data(), bytes.size());
+  bytes.back() ^= 0xFF;
+  corrupted->RemoveAtStart(corrupted->GetSize());
+  corrupted->AddAtEnd(Create<Packet>(bytes.data(), bytes.size()));
+  BOOST_REQUIRE_EQUAL(corrupted->GetUid(), packet->GetUid());
+  BlockHeader::unshareWire(corrupted);
+  extracted = BlockHeader::extractBlock(corrupted);
+  BOOST_CHECK(extracted != block);
+  BOOST_CHECK_EQUAL_COLLECTIONS(extracted.begin(), extracted.end(), bytes.begin(), bytes.end());
+
+  // other copies of the same transmission are deserialized too
+  extracted = BlockHeader::extractBlock(copy);
+  BOOST_CHECK(extracted == block);
+  BOOST_CHECK(extracted.wire() != block.wire());
+
+  BlockHeader::shareWire(packet, block);
+  BlockHeader::setSharedWireCapacity(0);
+  extracted = BlockHeader::extractBlock(copy);
+  BOOST_CHECK(extracted == block);
+  BOOST_CHECK(extracted.wire() != block.wire());
+  BlockHeader::setSharedWireCapacity(1024);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
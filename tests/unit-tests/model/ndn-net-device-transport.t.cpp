@@ -0,0 +1,125 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "model/ndn-net-device-transport.hpp"
+#include "helper/ndn-stack-helper.hpp"
+#include "helper/ndn-app-helper.hpp"
+#include "model/ndn-l3-protocol.hpp"
+
+#include "ns3/ndnSIM/NFD/daemon/face/generic-link-service.hpp"
+#include "ns3/network-module.h"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(ModelNdnNetDeviceTransport, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(EndpointIds)
+{
+  NodeContainer nodes;
+  nodes.Create(1);
+  SimpleNetDeviceHelper simpleHelper;
+  NetDeviceContainer devices = simpleHelper.Install(nodes);
+
+  NetDeviceTransport transport(nodes.Get(0), devices.Get(0), "netdev://[00:00:00:00:00:01]",
+                               "netdev://[ff:ff:ff:ff:ff:ff]");
+  Mac48Address a("00:00:00:00:00:0a");
+  Mac48Address b("00:00:00:00:00:0b");
+  BOOST_CHECK_EQUAL(transport.getEndpointId(a), 1);
+  BOOST_CHECK_EQUAL(transport.getEndpointId(a), 1);
+  BOOST_CHECK_EQUAL(transport.getEndpointId(b), 2);
+  BOOST_CHECK_EQUAL(transport.getEndpointId(a), 1);
+  BOOST_CHECK_EQUAL(transport.getEndpointId(Mac16Address("00:0a")), 3);
+  BOOST_CHECK_EQUAL(transport.getEndpointId(b), 2);
+}
+
+/** \brief run a consumer that requests Data from \p nSenders producers on a broadcast channel,
+ *         each Data being fragmented and sent at the same time as the others
+ *  \return the fraction of Interests of the consumer that were satisfied
+ */
+static double
+runConcurrentSenders(size_t nSenders)
+{
+  NodeContainer nodes;
+  nodes.Create(nSenders + 1);
+
+  SimpleNetDeviceHelper simpleHelper;
+  simpleHelper.SetDeviceAttribute("DataRate", DataRateValue(DataRate("250kbps")));
+  simpleHelper.SetChannelAttribute("Delay", TimeValue(MicroSeconds(10)));
+  NetDeviceContainer devices = simpleHelper.Install(nodes);
+  for (auto device = devices.Begin(); device != devices.End(); ++device) {
+    (*device)->SetMtu(200);
+  }
+
+  StackHelper consumerStack;
+  consumerStack.SetDefaultRoutes(true);
+  consumerStack.Install(nodes.Get(0));
+
+  StackHelper senderStack;
+  for (size_t i = 1; i <= nSenders; ++i) {
+    senderStack.Install(nodes.Get(i));
+    // senders have no route to the prefixes of the others, and must not Nack them
+    StrategyChoiceHelper::Install(nodes.Get(i), "/", "/localhost/nfd/strategy/best-route/%FD%01");
+  }
+
+  for (size_t i = 1; i <= nSenders; ++i) {
+    std::string prefix = "/sender" + std::to_string(i);
+
+    AppHelper consumerHelper("ns3::ndn::ConsumerCbr");
+    consumerHelper.SetPrefix(prefix);
+    consumerHelper.SetAttribute("Frequency", StringValue("10"));
+    consumerHelper.Install(nodes.Get(0)).Stop(Seconds(5));
+
+    AppHelper producerHelper("ns3::ndn::Producer");
+    producerHelper.SetPrefix(prefix);
+    producerHelper.SetAttribute("PayloadSize", StringValue("600"));
+    producerHelper.Install(nodes.Get(i));
+  }
+
+  Simulator::Stop(Seconds(6));
+  Simulator::Run();
+
+  auto face = L3Protocol::getL3Protocol(nodes.Get(0))->getFaceByNetDevice(devices.Get(0));
+  const auto& linkService = dynamic_cast<nfd::face::GenericLinkService&>(*face->getLinkService());
+  BOOST_CHECK_EQUAL(linkService.getCounters().nInNetInvalid, 0);
+  BOOST_CHECK_EQUAL(linkService.getCounters().nReassemblyTimeouts, 0);
+
+  double goodput = static_cast<double>(face->getCounters().nInData) /
+                   face->getCounters().nOutInterests;
+
+  Simulator::Destroy();
+  Names::Clear();
+  return goodput;
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentFragmentingSenders)
+{
+  for (size_t nSenders : {2, 5, 10, 20}) {
+    double goodput = runConcurrentSenders(nSenders);
+    BOOST_TEST_MESSAGE(nSenders << " senders: goodput " << goodput);
+    BOOST_CHECK_GE(goodput, 0.95);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,167 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include <ndn-cxx/detail/tag-host.hpp>
+#include <ndn-cxx/lp/geo-tag.hpp>
+#include <ndn-cxx/lp/pit-token.hpp>
+#include <ndn-cxx/lp/tags.hpp>
+
+#include "ns3/ndnSIM/utils/ndn-ns3-packet-tag.hpp"
+
+#include "../tests-common.hpp"
+
+#include <boost/mpl/vector.hpp>
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_AUTO_TEST_SUITE(NdnCxxTagHost)
+
+template<int TypeId>
+class TestTag : public ::ndn::Tag
+{
+public:
+  static constexpr int
+  getTypeId() noexcept
+  {
+    return TypeId;
+  }
+};
+
+using RemoveTag = std::function<void(const ::ndn::TagHost&)>;
+
+template<typename T>
+static RemoveTag
+makeRemoveTag()
+{
+  return [] (const ::ndn::TagHost& host) { host.removeTag<T>(); };
+}
+
+/** \brief sets a tag of each type stored in a fixed slot, and of a few types stored in the map
+ */
+static void
+setAllTags(const ::ndn::TagHost& host)
+{
+  ::ndn::Buffer token(4);
+  host.setTag(make_shared<lp::IncomingFaceIdTag>(1));
+  host.setTag(make_shared<lp::NextHopFaceIdTag>(2));
+  host.setTag(make_shared<lp::CachePolicyTag>(lp::CachePolicy()));
+  host.setTag(make_shared<lp::CongestionMarkTag>(3));
+  host.setTag(make_shared<lp::NonDiscoveryTag>(lp::EmptyValue{}));
+  host.setTag(make_shared<lp::PrefixAnnouncementTag>(lp::PrefixAnnouncementHeader()));
+  host.setTag(make_shared<lp::PitToken>(std::make_pair(token.cbegin(), token.cend())));
+  host.setTag(make_shared<lp::HopCountTag>(4));
+  host.setTag(make_shared<lp::GeoTag>(std::make_tuple(5, 6, 7)));
+  host.setTag(make_shared<TestTag<1>>());
+  host.setTag(make_shared<TestTag<16>>());
+  host.setTag(make_shared<Ns3PacketTag>(Create<ns3::Packet>()));
+}
+
+/** \return which of the tags set by setAllTags() are present, in the same order
+ */
+static std::vector<bool>
+getPresentTags(const ::ndn::TagHost& host)
+{
+  return {host.getTag<lp::IncomingFaceIdTag>() != nullptr,
+          host.getTag<lp::NextHopFaceIdTag>() != nullptr,
+          host.getTag<lp::CachePolicyTag>() != nullptr,
+          host.getTag<lp::CongestionMarkTag>() != nullptr,
+          host.getTag<lp::NonDiscoveryTag>() != nullptr,
+          host.getTag<lp::PrefixAnnouncementTag>() != nullptr,
+          host.getTag<lp::PitToken>() != nullptr,
+          host.getTag<lp::HopCountTag>() != nullptr,
+          host.getTag<lp::GeoTag>() != nullptr,
+          host.getTag<TestTag<1>>() != nullptr,
+          host.getTag<TestTag<16>>() != nullptr,
+          host.getTag<Ns3PacketTag>() != nullptr};
+}
+
+static const std::vector<RemoveTag> REMOVE_TAGS{
+  makeRemoveTag<lp::IncomingFaceIdTag>(),
+  makeRemoveTag<lp::NextHopFaceIdTag>(),
+  makeRemoveTag<lp::CachePolicyTag>(),
+  makeRemoveTag<lp::CongestionMarkTag>(),
+  makeRemoveTag<lp::NonDiscoveryTag>(),
+  makeRemoveTag<lp::PrefixAnnouncementTag>(),
+  makeRemoveTag<lp::PitToken>(),
+  makeRemoveTag<lp::HopCountTag>(),
+  makeRemoveTag<lp::GeoTag>(),
+  makeRemoveTag<TestTag<1>>(),
+  makeRemoveTag<TestTag<16>>(),
+  makeRemoveTag<Ns3PacketTag>(),
+};
+
+using TagHosts = boost::mpl::vector<::ndn::TagHost, Interest, Data>;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(EachTagIsIndependent, T, TagHosts)
+{
+  for (size_t i = 0; i < REMOVE_TAGS.size(); ++i) {
+    T host;
+    BOOST_CHECK(getPresentTags(host) == std::vector<bool>(REMOVE_TAGS.size(), false));
+
+    setAllTags(host);
+    BOOST_CHECK(getPresentTags(host) == std::vector<bool>(REMOVE_TAGS.size(), true));
+
+    REMOVE_TAGS[i](host);
+    std::vector<bool> expected(REMOVE_TAGS.size(), true);
+    expected[i] = false;
+    BOOST_CHECK_MESSAGE(getPresentTags(host) == expected, "removing tag " << i);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Values)
+{
+  ::ndn::TagHost host;
+  setAllTags(host);
+  BOOST_CHECK_EQUAL(host.getTag<lp::IncomingFaceIdTag>()->get(), 1U);
+  BOOST_CHECK_EQUAL(host.getTag<lp::NextHopFaceIdTag>()->get(), 2U);
+  BOOST_CHECK_EQUAL(host.getTag<lp::CongestionMarkTag>()->get(), 3U);
+  BOOST_CHECK_EQUAL(host.getTag<lp::HopCountTag>()->get(), 4U);
+  BOOST_CHECK(host.getTag<lp::GeoTag>()->getPos() == std::make_tuple(5, 6, 7));
+
+  // setting a tag replaces the previous one of the same type
+  host.setTag(make_shared<lp::HopCountTag>(8));
+  BOOST_CHECK_EQUAL(host.getTag<lp::HopCountTag>()->get(), 8U);
+  host.setTag<lp::HopCountTag>(nullptr);
+  BOOST_CHECK(host.getTag<lp::HopCountTag>() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(Copy)
+{
+  ::ndn::TagHost host;
+  setAllTags(host);
+
+  // a copy shares the tags, but setting a tag on it does not affect the original
+  ::ndn::TagHost copy(host);
+  BOOST_CHECK(getPresentTags(copy) == getPresentTags(host));
+  copy.setTag(make_shared<lp::IncomingFaceIdTag>(9));
+  copy.removeTag<lp::HopCountTag>();
+  copy.removeTag<TestTag<16>>();
+  BOOST_CHECK_EQUAL(copy.getTag<lp::IncomingFaceIdTag>()->get(), 9U);
+  BOOST_CHECK(copy.getTag<lp::HopCountTag>() == nullptr);
+  BOOST_CHECK(copy.getTag<TestTag<16>>() == nullptr);
+  BOOST_CHECK_EQUAL(host.getTag<lp::IncomingFaceIdTag>()->get(), 1U);
+  BOOST_CHECK(host.getTag<lp::HopCountTag>() != nullptr);
+  BOOST_CHECK(host.getTag<TestTag<16>>() != nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -23,6 +23,7 @@
 #include "ns3/core-module.h"
 #include "model/ndn-global-router.hpp"
 #include "helper/ndn-scenario-helper.hpp"
+#include "helper/ndn-stack-helper.hpp"
 
 #include "boost-test.hpp"
 
@@ -45,6 +46,19 @@ class ScenarioHelperWithCleanupFixture : public ScenarioHelper, public CleanupFi
 public:
 };
 
+/** \brief create a signed Data packet, fresh for 10 seconds
+ *  \param content the single content byte, to tell apart Data packets with the same name
+ */
+inline shared_ptr<Data>
+makeData(const Name& name, uint8_t content = 0)
+{
+  auto data = make_shared<Data>(name);
+  data->setFreshnessPeriod(time::seconds(10));
+  data->setContent(&content, sizeof(content));
+  StackHelper::getKeyChain().sign(*data);
+  return data;
+}
+
 } // namespace ndn
 } // namespace ns3
 
@@ -29,10 +29,10 @@ namespace ndn {
 
 class Ns3PacketTag : public ::ndn::Tag {
 public:
-  static size_t
-  getTypeId()
+  static constexpr int
+  getTypeId() noexcept
   {
-    return 0xaee87802; // md5("Ns3PacketTag")[0:8]
+    return static_cast<int>(0xaee87802); // md5("Ns3PacketTag")[0:8]
   }
 
   Ns3PacketTag(Ptr<const Packet> packet)
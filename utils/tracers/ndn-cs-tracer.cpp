@@ -28,6 +28,9 @@
 #include "ns3/simulator.h"
 #include "ns3/node-list.h"
 #include "ns3/log.h"
+#include "ns3/ndnSIM/model/ndn-l3-protocol.hpp"
+
+#include "daemon/fw/forwarder.hpp"
 
 #include <boost/lexical_cast.hpp>
 
@@ -256,6 +259,15 @@ CsTracer::Print(std::ostream& os) const
 
   PRINTER("CacheHits", m_cacheHits);
   PRINTER("CacheMisses", m_cacheMisses);
+
+  Ptr<L3Protocol> ndn = m_nodePtr != nullptr ? m_nodePtr->GetObject<L3Protocol>() : nullptr;
+  if (ndn != nullptr) {
+    const auto& cs = ndn->getForwarder()->getCs();
+    os << time.ToDouble(Time::S) << "\t" << m_node << "\t" << "Entries" << "\t" << cs.size()
+       << "\n";
+    os << time.ToDouble(Time::S) << "\t" << m_node << "\t" << "BytesPerEntry" << "\t"
+       << (cs.size() > 0 ? cs.getMemoryUsage() / cs.size() : 0) << "\n";
+  }
 }
 
 void